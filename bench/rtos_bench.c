@@ -0,0 +1,931 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Microbenchmarks das primitivas do kernel (alvo rtos_bench).
+ *            Mede, com o mesmo FreeRTOSConfig.h do firmware, o custo de
+ *            troca de contexto, notificações, filas, semáforos, mutex,
+ *            event groups e do despacho do timer daemon, além do custo de
+ *            CPU do display (transposição das rotações 90°/270° comparada
+ *            à cópia do quadro em formato nativo, e gráfico rolante
+ *            comparado ao redesenho da polilinha; formas cheias por faixas
+ *            comparadas à montagem pixel a pixel; polígonos e triângulos cheios em
+ *            tamanhos de ícone; montagem dos planos de cinza) e, com
+ *            displays ligados (BENCH_DISPLAY_PANELS), do envio de quadros
+ *            por I2C com um e com dois painéis e da taxa de planos do modo
+ *            de cinza a 400 kHz e 1 MHz. Cada teste repete
+ *            a operação BENCH_ITERATIONS vezes, cronometrado pelo timer de
+ *            64 bits em µs; o custo do próprio laço é calibrado antes e
+ *            descontado. Os ciclos são derivados de clk_sys.
+ *
+ *            Saída (uma linha por teste):
+ *              BENCH,<teste>,<operações>,<total_us>,<ns_por_op>,<ciclos_por_op>
+ *              BENCHJ,<teste>,<amostras>,<min_us>,<medio_us>,<max_us>
+ *              BENCHD,<teste>,<painéis>,<quadro_us>,<bytes_por_s>
+ *              BENCHF,<teste>,<lado_px>,<ns_por_preenchimento>,<preenchimentos_por_s>
+ *              BENCHG,<teste>,<i2c_hz>,<alvo_hz>,<planos_por_s>,<atrasados>,<montagem_us>,<envio_us>,<cpu_permil>
+ *
+ *  @file	    rtos_bench.c
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+/* ============================   LIBRARIES  =============================== */
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "timers.h"
+
+#include "ssd1306.h"
+#include "ssd1306_dma.h"
+#include "ssd1306_chart.h"
+#include "ssd1306_gray.h"
+
+/* =============================   MACROS   ================================ */
+
+#define BENCH_ITERATIONS      10000 // Repetições de cada teste
+#define BENCH_TIMER_SAMPLES   500   // Disparos medidos do timer periódico
+#define BENCH_YIELD_PRIORITY  1     // Par de tarefas do teste de taskYIELD
+#define BENCH_RUNNER_PRIORITY 2     // Tarefa que executa a suíte
+#define BENCH_PEER_PRIORITY   3     // Parceira dos testes de ida e volta (preempta o runner)
+#define BENCH_STACK_WORDS     512
+#define BENCH_DISPLAY_FRAMES  1000  // Quadros processados nos testes de display
+#define BENCH_FLUSH_FRAMES    50    // Quadros enviados por I2C em cada teste de envio
+#define BENCH_CHART_WIDTH     100   // Colunas (amostras na tela) do gráfico rolante
+#define BENCH_CHART_PAGES     4     // Altura do gráfico em páginas (32 px)
+#define BENCH_SHAPE_RADIUS    16    // Raio do círculo cheio (indicador de um medidor)
+#define BENCH_SHAPE_RX        40    // Raios da elipse cheia
+#define BENCH_SHAPE_RY        16
+#define BENCH_BUTTON_W        60    // Botão de cantos arredondados
+#define BENCH_BUTTON_H        24
+#define BENCH_BUTTON_R        6
+#define BENCH_ICON_FILLS      2000  // Preenchimentos medidos por ícone e tamanho
+#define BENCH_GRAY_PLANES     150   // Quadros de plano enviados em cada teste de cinza (50 ciclos)
+#define BENCH_GRAY_PLANE_HZ   90    // Taxa fixa de planos do teste com prazo (ciclo de cinza a 30 Hz)
+#ifndef BENCH_DISPLAY_PANELS
+#define BENCH_DISPLAY_PANELS  0     // Displays ligados: 1 (i2c1) ou 2 (i2c1 e i2c0); 0 pula o envio
+#endif
+
+#define BENCH_BIT_PING (1u << 0)
+#define BENCH_BIT_PONG (1u << 1)
+
+/* =============================   TYPES   ================================= */
+
+// Primitiva exercitada pela tarefa parceira nos testes de ida e volta
+typedef enum {
+  PEER_NOTIFY,
+  PEER_QUEUE,
+  PEER_SEMAPHORE,
+  PEER_EVENT_GROUP,
+} peer_mode_t;
+
+/* =========================   GLOBAL VARIABLES   ========================== */
+
+// Contador de trocas de contexto, incrementado por traceTASK_SWITCHED_IN()
+volatile uint32_t ulContextSwitchCount = 0;
+
+static TaskHandle_t runner = NULL;
+static TaskHandle_t peer = NULL;
+static QueueHandle_t q_ping, q_pong;
+static SemaphoreHandle_t sem_ping, sem_pong, mutex;
+static EventGroupHandle_t events;
+
+static uint32_t loop_ns_x1000 = 0; // Custo de uma volta vazia do laço (ns × 1000)
+
+static uint8_t bench_frame[128 * 64 / 8]; // Quadro 128x64 com conteúdo de teste
+static uint8_t bench_panel[128 * 64 / 8]; // Quadro do painel montado
+
+static volatile uint32_t pend_done_us; // Instante de execução do callback pendente
+static volatile uint32_t timer_last_us, timer_samples;
+static volatile uint32_t timer_min_us, timer_max_us, timer_sum_us;
+
+/* ========================   FUNCTION PROTOTYPE   ========================= */
+
+void bench_task(void *pvParameters);
+
+/* ===========================   MAIN FUNCTION   =========================== */
+int main(void)
+{
+  stdio_init_all();
+  sleep_ms(2000); // Tempo para abrir o terminal serial
+
+  xTaskCreate(bench_task, "Bench", BENCH_STACK_WORDS, NULL, BENCH_RUNNER_PRIORITY, &runner);
+  vTaskStartScheduler();
+
+  while (true)
+  {
+
+  }
+}/* end main */
+
+/* =======================  DEVELOPMENT OF FUNCTIONS ======================= */
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Mede o custo de uma volta do laço de teste sem operação alguma.
+ ----------------------------------------------------------------------------*/
+static void bench_calibrate(void)
+{
+  uint64_t start = time_us_64();
+  for (volatile uint32_t i = 0; i < BENCH_ITERATIONS; ++i)
+  {
+  }
+  loop_ns_x1000 = (uint32_t)((time_us_64() - start) * 1000000u / BENCH_ITERATIONS);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Imprime uma linha BENCH, descontando o custo do laço.
+ *
+ *  @param[in] name     : Nome do teste.
+ *  @param[in] ops      : Operações medidas.
+ *  @param[in] loops    : Voltas do laço (para descontar a calibração).
+ *  @param[in] total_us : Tempo total.
+ ----------------------------------------------------------------------------*/
+static void bench_report(const char *name, uint32_t ops, uint32_t loops, uint64_t total_us)
+{
+  uint64_t total_ns = total_us * 1000u;
+  uint64_t loop_ns = (uint64_t)loops * loop_ns_x1000 / 1000u;
+  uint64_t net_ns = (total_ns > loop_ns) ? total_ns - loop_ns : 0;
+  uint32_t ns_per_op = ops ? (uint32_t)(net_ns / ops) : 0;
+  uint32_t cycles_per_op = (uint32_t)((uint64_t)ns_per_op * (clock_get_hz(clk_sys) / 1000u) / 1000000u);
+
+  printf("BENCH,%s,%lu,%llu,%lu,%lu\n", name, (unsigned long)ops, (unsigned long long)total_us,
+         (unsigned long)ns_per_op, (unsigned long)cycles_per_op);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Tarefa parceira dos testes de ida e volta: espera o "ping" do
+ *  runner na primitiva escolhida e responde com o "pong". Roda com
+ *  prioridade maior, então cada ping causa uma troca de contexto imediata.
+ ----------------------------------------------------------------------------*/
+static void bench_peer(void *pvParameters)
+{
+  peer_mode_t mode = (peer_mode_t)(uintptr_t)pvParameters;
+  uint32_t item;
+
+  while (true)
+  {
+    switch (mode)
+    {
+    case PEER_NOTIFY:
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      xTaskNotifyGive(runner);
+      break;
+    case PEER_QUEUE:
+      xQueueReceive(q_ping, &item, portMAX_DELAY);
+      xQueueSend(q_pong, &item, portMAX_DELAY);
+      break;
+    case PEER_SEMAPHORE:
+      xSemaphoreTake(sem_ping, portMAX_DELAY);
+      xSemaphoreGive(sem_pong);
+      break;
+    case PEER_EVENT_GROUP:
+      xEventGroupWaitBits(events, BENCH_BIT_PING, pdTRUE, pdTRUE, portMAX_DELAY);
+      xEventGroupSetBits(events, BENCH_BIT_PONG);
+      break;
+    }
+  }
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Cria a parceira no modo dado. Com prioridade maior, ela executa de
+ *  imediato e já está bloqueada no "ping" quando a criação retorna.
+ ----------------------------------------------------------------------------*/
+static void bench_peer_start(peer_mode_t mode)
+{
+  xTaskCreate(bench_peer, "Peer", BENCH_STACK_WORDS, (void *)(uintptr_t)mode, BENCH_PEER_PRIORITY, &peer);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Remove a parceira e deixa a idle liberar sua memória.
+ ----------------------------------------------------------------------------*/
+static void bench_peer_stop(void)
+{
+  vTaskDelete(peer);
+  peer = NULL;
+  vTaskDelay(pdMS_TO_TICKS(10));
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Par de tarefas de mesma prioridade que só cedem a CPU uma à outra.
+ ----------------------------------------------------------------------------*/
+static void bench_yield_task(void *pvParameters)
+{
+  for (uint32_t i = 0; i < BENCH_ITERATIONS; ++i)
+  {
+    taskYIELD();
+  }
+  xTaskNotifyGive(runner);
+  vTaskDelete(NULL);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Troca de contexto pura: duas tarefas alternando com taskYIELD().
+ *  O número de trocas vem do próprio hook de trace.
+ ----------------------------------------------------------------------------*/
+static void bench_context_switch(void)
+{
+  uint32_t switches = ulContextSwitchCount;
+  uint64_t start = time_us_64();
+
+  xTaskCreate(bench_yield_task, "YieldA", BENCH_STACK_WORDS, NULL, BENCH_YIELD_PRIORITY, NULL);
+  xTaskCreate(bench_yield_task, "YieldB", BENCH_STACK_WORDS, NULL, BENCH_YIELD_PRIORITY, NULL);
+  ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+  ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+
+  uint64_t total = time_us_64() - start;
+  switches = ulContextSwitchCount - switches;
+  bench_report("ctx_switch_yield", switches, 0, total);
+  vTaskDelay(pdMS_TO_TICKS(10));
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Operações sem troca de contexto (quem dá é quem recebe).
+ ----------------------------------------------------------------------------*/
+static void bench_local(void)
+{
+  uint32_t item = 0;
+  uint64_t start;
+
+  start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_ITERATIONS; ++i)
+  {
+    xTaskNotifyGive(runner);
+    ulTaskNotifyTake(pdTRUE, 0);
+  }
+  bench_report("notify_give_take", BENCH_ITERATIONS, BENCH_ITERATIONS, time_us_64() - start);
+
+  start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_ITERATIONS; ++i)
+  {
+    xQueueSend(q_ping, &item, 0);
+    xQueueReceive(q_ping, &item, 0);
+  }
+  bench_report("queue_send_receive", BENCH_ITERATIONS, BENCH_ITERATIONS, time_us_64() - start);
+
+  start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_ITERATIONS; ++i)
+  {
+    xSemaphoreGive(sem_ping);
+    xSemaphoreTake(sem_ping, 0);
+  }
+  bench_report("sem_give_take", BENCH_ITERATIONS, BENCH_ITERATIONS, time_us_64() - start);
+
+  start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_ITERATIONS; ++i)
+  {
+    xSemaphoreTake(mutex, 0);
+    xSemaphoreGive(mutex);
+  }
+  bench_report("mutex_take_give", BENCH_ITERATIONS, BENCH_ITERATIONS, time_us_64() - start);
+
+  start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_ITERATIONS; ++i)
+  {
+    xEventGroupSetBits(events, BENCH_BIT_PING);
+    xEventGroupWaitBits(events, BENCH_BIT_PING, pdTRUE, pdTRUE, 0);
+  }
+  bench_report("evgroup_set_wait", BENCH_ITERATIONS, BENCH_ITERATIONS, time_us_64() - start);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Ida e volta com a parceira: cada volta inclui duas trocas de
+ *  contexto (runner -> parceira -> runner) e a latência de desbloqueio.
+ ----------------------------------------------------------------------------*/
+static void bench_roundtrip(void)
+{
+  uint32_t item = 0;
+  uint64_t start;
+
+  bench_peer_start(PEER_NOTIFY);
+  start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_ITERATIONS; ++i)
+  {
+    xTaskNotifyGive(peer);
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  }
+  bench_report("notify_roundtrip", BENCH_ITERATIONS, BENCH_ITERATIONS, time_us_64() - start);
+  bench_peer_stop();
+
+  bench_peer_start(PEER_QUEUE);
+  start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_ITERATIONS; ++i)
+  {
+    xQueueSend(q_ping, &item, portMAX_DELAY);
+    xQueueReceive(q_pong, &item, portMAX_DELAY);
+  }
+  bench_report("queue_roundtrip", BENCH_ITERATIONS, BENCH_ITERATIONS, time_us_64() - start);
+  bench_peer_stop();
+
+  bench_peer_start(PEER_SEMAPHORE);
+  start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_ITERATIONS; ++i)
+  {
+    xSemaphoreGive(sem_ping);
+    xSemaphoreTake(sem_pong, portMAX_DELAY);
+  }
+  bench_report("sem_roundtrip", BENCH_ITERATIONS, BENCH_ITERATIONS, time_us_64() - start);
+  bench_peer_stop();
+
+  bench_peer_start(PEER_EVENT_GROUP);
+  start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_ITERATIONS; ++i)
+  {
+    xEventGroupSetBits(events, BENCH_BIT_PING);
+    xEventGroupWaitBits(events, BENCH_BIT_PONG, pdTRUE, pdTRUE, portMAX_DELAY);
+  }
+  bench_report("evgroup_roundtrip", BENCH_ITERATIONS, BENCH_ITERATIONS, time_us_64() - start);
+  bench_peer_stop();
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Callback executado pelo timer daemon via xTimerPendFunctionCall.
+ ----------------------------------------------------------------------------*/
+static void bench_pend_cb(void *param, uint32_t value)
+{
+  pend_done_us = time_us_32();
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Callback do timer periódico de 1 tick: acumula o intervalo real
+ *  entre disparos e avisa o runner ao completar as amostras.
+ ----------------------------------------------------------------------------*/
+static void bench_timer_cb(TimerHandle_t timer)
+{
+  uint32_t now = time_us_32();
+
+  if (timer_last_us != 0)
+  {
+    uint32_t period = now - timer_last_us;
+    timer_sum_us += period;
+    if (period < timer_min_us)
+    {
+      timer_min_us = period;
+    }
+    if (period > timer_max_us)
+    {
+      timer_max_us = period;
+    }
+    if (++timer_samples == BENCH_TIMER_SAMPLES)
+    {
+      xTimerStop(timer, 0);
+      xTaskNotifyGive(runner);
+    }
+  }
+  timer_last_us = now;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Timer daemon: latência de despacho de uma chamada pendente (o
+ *  daemon tem prioridade máxima e preempta o runner) e jitter de um timer
+ *  periódico de 1 tick.
+ ----------------------------------------------------------------------------*/
+static void bench_timers(void)
+{
+  uint32_t min = UINT32_MAX, max = 0;
+  uint64_t sum = 0;
+
+  for (uint32_t i = 0; i < BENCH_ITERATIONS; ++i)
+  {
+    uint32_t start = time_us_32();
+    xTimerPendFunctionCall(bench_pend_cb, NULL, 0, portMAX_DELAY);
+    uint32_t latency = pend_done_us - start;
+
+    sum += latency;
+    min = (latency < min) ? latency : min;
+    max = (latency > max) ? latency : max;
+  }
+  printf("BENCHJ,timer_pend_latency,%lu,%lu,%lu,%lu\n", (unsigned long)BENCH_ITERATIONS,
+         (unsigned long)min, (unsigned long)(sum / BENCH_ITERATIONS), (unsigned long)max);
+
+  timer_last_us = 0;
+  timer_samples = 0;
+  timer_min_us = UINT32_MAX;
+  timer_max_us = 0;
+  timer_sum_us = 0;
+
+  TimerHandle_t timer = xTimerCreate("BenchTmr", 1, pdTRUE, NULL, bench_timer_cb);
+  xTimerStart(timer, portMAX_DELAY);
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  xTimerDelete(timer, portMAX_DELAY);
+
+  printf("BENCHJ,timer_period_1tick,%lu,%lu,%lu,%lu\n", (unsigned long)timer_samples,
+         (unsigned long)timer_min_us, (unsigned long)(timer_sum_us / timer_samples),
+         (unsigned long)timer_max_us);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Custo por quadro da transposição 8x8 das rotações 90°/270°, sem o
+ *  I2C: monta todas as páginas do painel a partir de um quadro girado. A
+ *  referência é a cópia do quadro em formato nativo (0°/180°), que é o que o
+ *  flush faz sem rotação.
+ ----------------------------------------------------------------------------*/
+static void bench_display(void)
+{
+  ssd1306_t disp = {
+    .width = 64, .height = 128, .pages = 16, // Geometria lógica girada
+    .buffer = bench_frame, .bufsize = sizeof(bench_frame), .buf_pages = 16,
+  };
+
+  for (uint32_t i = 0; i < sizeof(bench_frame); ++i)
+  {
+    bench_frame[i] = (uint8_t)(i * 37u + 11u);
+  }
+
+  uint64_t start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_DISPLAY_FRAMES; ++i)
+  {
+    memcpy(bench_panel, bench_frame, sizeof(bench_frame));
+  }
+  bench_report("display_copy_0", BENCH_DISPLAY_FRAMES, BENCH_DISPLAY_FRAMES, time_us_64() - start);
+
+  static const ssd1306_rotation_t rotations[] = { SSD1306_ROTATE_90, SSD1306_ROTATE_270 };
+  static const char *const names[] = { "display_transpose_90", "display_transpose_270" };
+  for (uint r = 0; r < 2; ++r)
+  {
+    disp.rotation = rotations[r];
+    start = time_us_64();
+    for (uint32_t i = 0; i < BENCH_DISPLAY_FRAMES; ++i)
+    {
+      for (uint32_t page = 0; page < disp.width / 8; ++page)
+      {
+        ssd1306_transpose_page(&disp, page, &bench_panel[page * disp.height]);
+      }
+    }
+    bench_report(names[r], BENCH_DISPLAY_FRAMES, BENCH_DISPLAY_FRAMES, time_us_64() - start);
+  }
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Amostra de teste do gráfico: onda triangular de 0 a 99.
+ ----------------------------------------------------------------------------*/
+static int32_t bench_chart_sample(uint32_t i)
+{
+  uint32_t phase = i % 200u;
+  return (int32_t)(phase < 100u ? phase : 199u - phase);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Custo de acrescentar uma amostra ao gráfico rolante com a tela
+ *  cheia (BENCH_CHART_WIDTH amostras de histórico), nos modos linha e
+ *  envoltória, comparado ao redesenho de toda a polilinha com
+ *  ssd1306_draw_line a cada amostra. Escala fixa, sem redesenhos.
+ ----------------------------------------------------------------------------*/
+static void bench_chart(void)
+{
+  ssd1306_t disp = {
+    .width = 128, .height = 64, .pages = 8,
+    .buffer = bench_frame, .bufsize = sizeof(bench_frame), .buf_pages = 8,
+  };
+  ssd1306_chart_t chart;
+  static const char *const names[] = { "chart_push_line", "chart_push_envelope" };
+
+  for (uint mode = SSD1306_CHART_LINE; mode <= SSD1306_CHART_ENVELOPE; ++mode)
+  {
+    if (!ssd1306_chart_init(&chart, &disp, 0, 0, BENCH_CHART_WIDTH, BENCH_CHART_PAGES, mode))
+    {
+      printf("BENCH,chart_init_failed\n");
+      return;
+    }
+    ssd1306_chart_set_range(&chart, 0, 99, false);
+    for (uint32_t i = 0; i < BENCH_CHART_WIDTH; ++i)
+    {
+      ssd1306_chart_push(&chart, bench_chart_sample(i)); // Tela cheia antes de medir
+    }
+
+    uint64_t start = time_us_64();
+    for (uint32_t i = 0; i < BENCH_DISPLAY_FRAMES; ++i)
+    {
+      int32_t v = bench_chart_sample(i);
+      if (mode == SSD1306_CHART_LINE)
+      {
+        ssd1306_chart_push(&chart, v);
+      }
+      else
+      {
+        ssd1306_chart_push_envelope(&chart, v - 5, v + 5);
+      }
+    }
+    bench_report(names[mode], BENCH_DISPLAY_FRAMES, BENCH_DISPLAY_FRAMES, time_us_64() - start);
+    ssd1306_chart_deinit(&chart);
+  }
+
+  // Referência: limpa a região e redesenha os BENCH_CHART_WIDTH pontos
+  const uint32_t h = BENCH_CHART_PAGES * 8;
+  uint64_t start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_DISPLAY_FRAMES; ++i)
+  {
+    for (uint32_t page = 0; page < BENCH_CHART_PAGES; ++page)
+    {
+      memset(&bench_frame[page * disp.width], 0, BENCH_CHART_WIDTH);
+    }
+    for (uint32_t x = 1; x < BENCH_CHART_WIDTH; ++x)
+    {
+      ssd1306_draw_line(&disp, x - 1, h - 1 - bench_chart_sample(i + x - 1) * (h - 1) / 99,
+                        x, h - 1 - bench_chart_sample(i + x) * (h - 1) / 99);
+    }
+  }
+  bench_report("chart_polyline_redraw", BENCH_DISPLAY_FRAMES, BENCH_DISPLAY_FRAMES, time_us_64() - start);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Referência das formas cheias: percorre o retângulo envolvente e
+ *  desenha pixel a pixel os pontos dentro da elipse (rx, ry) centrada em
+ *  (cx, cy), como a aplicação faria sem as primitivas da biblioteca. Um
+ *  retângulo de cantos arredondados é a mesma elipse "esticada" por
+ *  (sx, sy) pixels no centro.
+ ----------------------------------------------------------------------------*/
+static void bench_shape_pixels(ssd1306_t *p, int32_t cx, int32_t cy, int32_t rx, int32_t ry, int32_t sx, int32_t sy)
+{
+  int64_t rx2 = (int64_t)rx * rx, ry2 = (int64_t)ry * ry;
+
+  for (int32_t y = -ry - sy; y <= ry; ++y)
+  {
+    int32_t dy = (y < -sy) ? y + sy : (y > 0 ? y : 0);
+    for (int32_t x = -rx - sx; x <= rx; ++x)
+    {
+      int32_t dx = (x < -sx) ? x + sx : (x > 0 ? x : 0);
+      if (dx * dx * ry2 + dy * dy * rx2 <= rx2 * ry2 + (rx * ry2 + ry * rx2) / 2)
+      {
+        ssd1306_draw_pixel(p, cx + x, cy + y);
+      }
+    }
+  }
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Custo das formas cheias da biblioteca (midpoint + faixas
+ *  horizontais escritas com máscara de página) comparado à montagem pixel a
+ *  pixel das mesmas formas: o indicador circular de um medidor, uma elipse
+ *  e um botão de cantos arredondados.
+ ----------------------------------------------------------------------------*/
+static void bench_shapes(void)
+{
+  ssd1306_t disp = {
+    .width = 128, .height = 64, .pages = 8,
+    .buffer = bench_frame, .bufsize = sizeof(bench_frame), .buf_pages = 8,
+  };
+  const int32_t r = BENCH_SHAPE_RADIUS, w = BENCH_BUTTON_W, h = BENCH_BUTTON_H, br = BENCH_BUTTON_R;
+
+  uint64_t start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_DISPLAY_FRAMES; ++i)
+  {
+    ssd1306_fill_circle(&disp, 64, 32, r);
+  }
+  bench_report("shape_circle_span", BENCH_DISPLAY_FRAMES, BENCH_DISPLAY_FRAMES, time_us_64() - start);
+
+  start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_DISPLAY_FRAMES; ++i)
+  {
+    bench_shape_pixels(&disp, 64, 32, r, r, 0, 0);
+  }
+  bench_report("shape_circle_pixel", BENCH_DISPLAY_FRAMES, BENCH_DISPLAY_FRAMES, time_us_64() - start);
+
+  start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_DISPLAY_FRAMES; ++i)
+  {
+    ssd1306_fill_ellipse(&disp, 64, 32, BENCH_SHAPE_RX, BENCH_SHAPE_RY);
+  }
+  bench_report("shape_ellipse_span", BENCH_DISPLAY_FRAMES, BENCH_DISPLAY_FRAMES, time_us_64() - start);
+
+  start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_DISPLAY_FRAMES; ++i)
+  {
+    bench_shape_pixels(&disp, 64, 32, BENCH_SHAPE_RX, BENCH_SHAPE_RY, 0, 0);
+  }
+  bench_report("shape_ellipse_pixel", BENCH_DISPLAY_FRAMES, BENCH_DISPLAY_FRAMES, time_us_64() - start);
+
+  start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_DISPLAY_FRAMES; ++i)
+  {
+    ssd1306_fill_round_rect(&disp, 34, 20, w, h, br);
+  }
+  bench_report("shape_button_span", BENCH_DISPLAY_FRAMES, BENCH_DISPLAY_FRAMES, time_us_64() - start);
+
+  start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_DISPLAY_FRAMES; ++i)
+  {
+    bench_shape_pixels(&disp, 34 + w - 1 - br, 20 + h - 1 - br, br, br, w - 1 - 2 * br, h - 1 - 2 * br);
+  }
+  bench_report("shape_button_pixel", BENCH_DISPLAY_FRAMES, BENCH_DISPLAY_FRAMES, time_us_64() - start);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Preenchimentos por segundo de ícones vetoriais em tamanhos típicos
+ *  (8, 16 e 32 px de lado): uma seta de 7 vértices desenhada a partir de um
+ *  único contorno escalado, um triângulo (barra de sinal) e a mesma seta
+ *  recortada pela metade por um retângulo de recorte.
+ ----------------------------------------------------------------------------*/
+static void bench_polygons(void)
+{
+  ssd1306_t disp = {
+    .width = 128, .height = 64, .pages = 8,
+    .buffer = bench_frame, .bufsize = sizeof(bench_frame), .buf_pages = 8,
+  };
+  // Seta apontando para a direita num quadro de 16x16 unidades
+  static const ssd1306_point_t arrow[] = {
+    {0, 6}, {10, 6}, {10, 0}, {16, 8}, {10, 16}, {10, 10}, {0, 10},
+  };
+  static const uint32_t sizes[] = { 8, 16, 32 };
+  static const char *const names[] = { "poly_arrow", "poly_triangle", "poly_arrow_clip" };
+
+  for (uint s = 0; s < count_of(sizes); ++s)
+  {
+    int32_t side = sizes[s];
+    ssd1306_rect_t clip = { 0, 0, side / 2, side }; // Metade esquerda do ícone
+    for (uint test = 0; test < count_of(names); ++test)
+    {
+      uint64_t start = time_us_64();
+      for (uint32_t i = 0; i < BENCH_ICON_FILLS; ++i)
+      {
+        if (test == 1)
+        {
+          ssd1306_fill_triangle(&disp, 0, side, side, 0, side, side);
+        }
+        else
+        {
+          ssd1306_fill_polygon_scaled(&disp, arrow, count_of(arrow), 0, 0, side * 16,
+                                      (test == 2) ? &clip : NULL);
+        }
+      }
+      uint64_t ns = (time_us_64() - start) * 1000u / BENCH_ICON_FILLS;
+      printf("BENCHF,%s,%lu,%lu,%lu\n", names[test], (unsigned long)side, (unsigned long)ns,
+             (unsigned long)(ns ? 1000000000u / ns : 0));
+    }
+  }
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Preenche o buffer de cinza de teste: "gray_full" tem níveis
+ *  aleatórios em toda a tela (toda página muda a cada plano) e "gray_icon"
+ *  uma tela típica, com texto em nível 3 e um único ícone cinza de 32x16 px
+ *  (duas páginas mudam entre planos).
+ ----------------------------------------------------------------------------*/
+static void bench_gray_fill(ssd1306_gray_t *g, bool full)
+{
+  ssd1306_gray_clear(g, 0);
+  if (full)
+  {
+    uint32_t seed = 1;
+    for (uint32_t y = 0; y < g->disp->height; ++y)
+    {
+      for (uint32_t x = 0; x < g->disp->width; ++x)
+      {
+        seed = seed * 1103515245u + 12345u;
+        ssd1306_gray_pixel(g, x, y, seed >> 30);
+      }
+    }
+    return;
+  }
+  ssd1306_draw_string(ssd1306_gray_begin(g), 0, 0, 1, "Tags lidas: 42");
+  ssd1306_gray_paint(g, 3);
+  ssd1306_fill_round_rect(ssd1306_gray_begin(g), 48, 24, 32, 16, 4);
+  ssd1306_gray_paint(g, 1);
+  ssd1306_fill_circle(ssd1306_gray_begin(g), 64, 32, 6);
+  ssd1306_gray_paint(g, 2);
+}
+
+#if BENCH_DISPLAY_PANELS > 0
+/*! ---------------------------------------------------------------------------
+ *  @brief Envia BENCH_GRAY_PLANES planos e imprime uma linha BENCHG. Com
+ *  `hz` = 0 os planos saem um atrás do outro (taxa máxima); senão cada plano
+ *  espera o seu prazo, como o motor do core 1, e os que estouram o período
+ *  são contados. O custo de CPU é a fração do tempo montando e enviando.
+ *
+ *  @param[in] name   : Nome do teste.
+ *  @param[in] g      : Buffer de cinza, já preenchido.
+ *  @param[in] i2c_hz : Clock do I2C em uso (só para o relatório).
+ *  @param[in] hz     : Taxa fixa de planos, ou 0.
+ ----------------------------------------------------------------------------*/
+static void bench_gray_run(const char *name, ssd1306_gray_t *g, uint32_t i2c_hz, uint32_t hz)
+{
+  uint64_t build_us = 0, send_us = 0;
+  uint32_t late = 0;
+  absolute_time_t next = get_absolute_time();
+  uint64_t start = time_us_64();
+
+  for (uint32_t i = 0; i < BENCH_GRAY_PLANES; ++i)
+  {
+    uint64_t t0 = time_us_64();
+    uint32_t pages = ssd1306_gray_build(g->disp, g->lo, g->hi, i % SSD1306_GRAY_PHASES);
+    uint64_t t1 = time_us_64();
+    ssd1306_gray_send(g->disp, pages);
+    build_us += t1 - t0;
+    send_us += time_us_64() - t1;
+
+    if (hz != 0)
+    {
+      next = delayed_by_us(next, 1000000u / hz);
+      if (absolute_time_diff_us(get_absolute_time(), next) < 0)
+      {
+        ++late;
+        next = get_absolute_time();
+      }
+      else
+      {
+        busy_wait_until(next);
+      }
+    }
+  }
+
+  uint64_t total_us = time_us_64() - start;
+  printf("BENCHG,%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu\n", name, (unsigned long)i2c_hz, (unsigned long)hz,
+         (unsigned long)(total_us ? (uint64_t)BENCH_GRAY_PLANES * 1000000u / total_us : 0),
+         (unsigned long)late, (unsigned long)(build_us / BENCH_GRAY_PLANES),
+         (unsigned long)(send_us / BENCH_GRAY_PLANES),
+         (unsigned long)(total_us ? (build_us + send_us) * 1000u / total_us : 0));
+}
+#endif
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Modo de cinza por pontilhamento temporal. Sem displays mede só a
+ *  CPU: montagem de um plano no buffer do display e pintura de uma forma
+ *  da caneta nos planos. Com o display do i2c1 ligado mede a taxa máxima de
+ *  planos e o custo de CPU à taxa fixa BENCH_GRAY_PLANE_HZ, com o I2C na
+ *  configuração atual (400 kHz) e no Fast-mode Plus (1 MHz), que o SSD1306
+ *  costuma aceitar fora da especificação.
+ ----------------------------------------------------------------------------*/
+static void bench_gray(void)
+{
+  ssd1306_t disp = {
+    .width = 128, .height = 64, .pages = 8,
+    .buffer = bench_frame, .bufsize = sizeof(bench_frame), .buf_pages = 8,
+  };
+  ssd1306_gray_t g;
+
+  if (!ssd1306_gray_init(&g, &disp))
+  {
+    printf("BENCH,gray_init_failed\n");
+    return;
+  }
+  bench_gray_fill(&g, true);
+
+  uint64_t start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_DISPLAY_FRAMES; ++i)
+  {
+    (void)ssd1306_gray_build(&disp, g.lo, g.hi, i % SSD1306_GRAY_PHASES);
+  }
+  bench_report("gray_build_plane", BENCH_DISPLAY_FRAMES, BENCH_DISPLAY_FRAMES, time_us_64() - start);
+
+  ssd1306_fill_circle(ssd1306_gray_begin(&g), 64, 32, BENCH_SHAPE_RADIUS);
+  start = time_us_64();
+  for (uint32_t i = 0; i < BENCH_DISPLAY_FRAMES; ++i)
+  {
+    ssd1306_gray_paint(&g, i & 3);
+  }
+  bench_report("gray_paint_circle", BENCH_DISPLAY_FRAMES, BENCH_DISPLAY_FRAMES, time_us_64() - start);
+  ssd1306_gray_deinit(&g);
+
+#if BENCH_DISPLAY_PANELS > 0
+  static ssd1306_t panel;
+  static const uint32_t clocks[] = { 400000, 1000000 };
+
+  i2c_init(i2c1, clocks[0]);
+  gpio_set_function(14, GPIO_FUNC_I2C);
+  gpio_set_function(15, GPIO_FUNC_I2C);
+  gpio_pull_up(14);
+  gpio_pull_up(15);
+  panel.external_vcc = false;
+  if (!ssd1306_init(&panel, 128, 64, 0x3C, i2c1) || !ssd1306_gray_init(&g, &panel))
+  {
+    printf("BENCH,gray_panel_init_failed\n");
+    return;
+  }
+
+  for (uint c = 0; c < count_of(clocks); ++c)
+  {
+    i2c_set_baudrate(i2c1, clocks[c]);
+    for (uint full = 0; full < 2; ++full)
+    {
+      const char *name = full ? "gray_full" : "gray_icon";
+      bench_gray_fill(&g, full);
+      bench_gray_run(name, &g, clocks[c], 0);
+      bench_gray_run(name, &g, clocks[c], BENCH_GRAY_PLANE_HZ);
+    }
+  }
+  i2c_set_baudrate(i2c1, clocks[0]);
+  ssd1306_gray_deinit(&g);
+  ssd1306_deinit(&panel);
+#endif
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Imprime uma linha BENCHD: tempo por quadro (todos os painéis) e
+ *  vazão agregada de bytes de pixel.
+ *
+ *  @param[in] name     : Nome do teste.
+ *  @param[in] panels   : Painéis enviados em cada quadro.
+ *  @param[in] total_us : Tempo de BENCH_FLUSH_FRAMES quadros.
+ ----------------------------------------------------------------------------*/
+static void bench_flush_report(const char *name, uint panels, uint64_t total_us)
+{
+  uint64_t bytes = (uint64_t)panels * sizeof(bench_frame) * BENCH_FLUSH_FRAMES;
+
+  printf("BENCHD,%s,%u,%lu,%lu\n", name, panels, (unsigned long)(total_us / BENCH_FLUSH_FRAMES),
+         (unsigned long)(total_us ? bytes * 1000000u / total_us : 0));
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Envio de quadros 128x64 por I2C a 400 kHz: um painel e, se houver,
+ *  dois painéis em controladores diferentes, um após o outro pelo envio
+ *  bloqueante (ssd1306_show) e juntos por DMA (ssd1306_dma_show_all).
+ *  Precisa dos displays ligados (i2c1 em GP14/15, i2c0 em GP0/1).
+ ----------------------------------------------------------------------------*/
+static void bench_flush(void)
+{
+#if BENCH_DISPLAY_PANELS > 0
+  static ssd1306_t panels[2];
+  static ssd1306_dma_t dma[2];
+  i2c_inst_t *const ports[2] = { i2c1, i2c0 };
+  static const uint pins[2][2] = { { 14, 15 }, { 0, 1 } }; // SDA, SCL
+
+  for (uint i = 0; i < BENCH_DISPLAY_PANELS; ++i)
+  {
+    i2c_init(ports[i], 400000);
+    gpio_set_function(pins[i][0], GPIO_FUNC_I2C);
+    gpio_set_function(pins[i][1], GPIO_FUNC_I2C);
+    gpio_pull_up(pins[i][0]);
+    gpio_pull_up(pins[i][1]);
+    panels[i].external_vcc = false;
+    if (!ssd1306_init(&panels[i], 128, 64, 0x3C, ports[i]) || !ssd1306_dma_init(&dma[i], &panels[i]))
+    {
+      printf("BENCH,flush_init_failed,%u\n", i);
+      return;
+    }
+    memcpy(panels[i].buffer, bench_frame, sizeof(bench_frame));
+  }
+
+  for (uint n = 1; n <= BENCH_DISPLAY_PANELS; ++n)
+  {
+    uint64_t start = time_us_64();
+    for (uint32_t f = 0; f < BENCH_FLUSH_FRAMES; ++f)
+    {
+      for (uint i = 0; i < n; ++i)
+      {
+        ssd1306_show(&panels[i]);
+      }
+    }
+    bench_flush_report("flush_blocking", n, time_us_64() - start);
+
+    start = time_us_64();
+    for (uint32_t f = 0; f < BENCH_FLUSH_FRAMES; ++f)
+    {
+      ssd1306_dma_show_all(dma, n);
+    }
+    bench_flush_report("flush_dma", n, time_us_64() - start);
+  }
+#endif
+}
+
+/* ===========================  DEVELOPMENT TASKS ========================== */
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Tarefa que executa a suíte uma vez e imprime os resultados.
+ *  A primeira linha descreve a configuração medida:
+ *  BENCH,config,<clk_sys_hz>,<tick_hz>,<preempção>,<time_slicing>,<iterações>
+ *
+ *  @param[in] pvParameters : Parâmetro genérico da tarefa, não utilizado nesta função.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void bench_task(void *pvParameters)
+{
+  q_ping = xQueueCreate(1, sizeof(uint32_t));
+  q_pong = xQueueCreate(1, sizeof(uint32_t));
+  sem_ping = xSemaphoreCreateBinary();
+  sem_pong = xSemaphoreCreateBinary();
+  mutex = xSemaphoreCreateMutex();
+  events = xEventGroupCreate();
+  configASSERT(q_ping && q_pong && sem_ping && sem_pong && mutex && events);
+
+  bench_calibrate();
+  printf("BENCH,config,%lu,%lu,%d,%d,%d\n", (unsigned long)clock_get_hz(clk_sys),
+         (unsigned long)configTICK_RATE_HZ, configUSE_PREEMPTION, configUSE_TIME_SLICING,
+         BENCH_ITERATIONS);
+  printf("BENCH,loop_overhead_ns_x1000,%lu\n", (unsigned long)loop_ns_x1000);
+
+  bench_context_switch();
+  bench_local();
+  bench_roundtrip();
+  bench_timers();
+  bench_display();
+  bench_chart();
+  bench_shapes();
+  bench_polygons();
+  bench_flush();
+  bench_gray();
+
+  printf("BENCH,done\n");
+  vTaskDelete(NULL);
+}
+/* end program */
@@ -55,7 +55,11 @@
 /* Synchronization Related */
 #define configUSE_MUTEXES                       1
 #define configUSE_RECURSIVE_MUTEXES             1
+#if defined(APP_WCET) && APP_WCET
+#define configUSE_APPLICATION_TASK_TAG          1 /* per-task CPU clock for src/wcet.c */
+#else
 #define configUSE_APPLICATION_TASK_TAG          0
+#endif
 #define configUSE_COUNTING_SEMAPHORES           1
 #define configQUEUE_REGISTRY_SIZE               8
 #define configUSE_QUEUE_SETS                    1
@@ -139,4 +143,19 @@ to exclude the API function. */
 
 /* A header file that defines trace macro can be included here. */
 
+/* Context switch counter, used by the application to compare architectures */
+#ifndef __ASSEMBLER__
+#include <stdint.h>
+extern volatile uint32_t ulContextSwitchCount;
+#if defined(APP_WCET) && APP_WCET
+/* Per-task CPU time accounting for the WCET capture (src/wcet.c) */
+extern void wcet_trace_switched_in( void * pvTag );
+extern void wcet_trace_switched_out( void * pvTag );
+#define traceTASK_SWITCHED_IN()                 do { ulContextSwitchCount++; wcet_trace_switched_in( ( void * ) pxCurrentTCB->pxTaskTag ); } while( 0 )
+#define traceTASK_SWITCHED_OUT()                wcet_trace_switched_out( ( void * ) pxCurrentTCB->pxTaskTag )
+#else
+#define traceTASK_SWITCHED_IN()                 ( ulContextSwitchCount++ )
+#endif
+#endif
+
 #endif /* FREERTOS_CONFIG_H */
\ No newline at end of file
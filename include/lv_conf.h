@@ -0,0 +1,42 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Configuração do LVGL (v9) para o OLED SSD1306 de 1 bpp.
+ *            Só as opções que diferem do padrão do LVGL estão aqui; o resto
+ *            vem de lv_conf_internal.h. Usado apenas com APP_LVGL=ON.
+ *
+ *  @file	    lv_conf.h
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+/* =============================   MACROS   ================================ */
+
+// --- Cor e memória ---
+#define LV_COLOR_DEPTH 1             // Display monocromático (LV_COLOR_FORMAT_I1)
+#define LV_USE_STDLIB_MALLOC LV_STDLIB_BUILTIN
+#define LV_MEM_SIZE (16 * 1024)      // Heap próprio do LVGL (objetos e estilos)
+#define LV_DRAW_SW_SUPPORT_I1 1      // Renderização direta em 1 bpp
+
+// --- Sistema ---
+#define LV_USE_OS LV_OS_NONE         // Exclusão mútua feita pelo port (lvgl_port_lock)
+#define LV_DEF_REFR_PERIOD 50        // Período de refresh (ms); o port também força refresh
+#define LV_USE_LOG 0
+
+// --- Fontes ---
+#define LV_FONT_MONTSERRAT_8 1       // Texto em escala 1 das telas
+#define LV_FONT_MONTSERRAT_14 0
+#define LV_FONT_MONTSERRAT_16 1      // Texto em escala 2 / fonte de 16 px
+#define LV_FONT_DEFAULT &lv_font_montserrat_8
+
+// --- Temas e widgets ---
+#define LV_USE_THEME_DEFAULT 0
+#define LV_USE_THEME_MONO 1
+
+#endif /* LV_CONF_H */
@@ -1,13 +1,17 @@
 #ifndef _inc_font
 #define _inc_font
 
+#ifndef SSD1306_FONT_ATTR
+#define SSD1306_FONT_ATTR
+#endif
+
 /*
  * Format
  * <height>, <width>, <additional spacing per char>, 
  * <first ascii char>, <last ascii char>,
  * <data>
  */
-const uint8_t font_8x5[] =
+const uint8_t font_8x5[] SSD1306_FONT_ATTR =
 {
 			8, 5, 1, 32, 126,
 			0x00, 0x00, 0x00, 0x00, 0x00,
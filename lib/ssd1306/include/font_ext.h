@@ -0,0 +1,182 @@
+/*
+ * Extended characters of font_8x5, generated by tools/fontgen.py.
+ * Do not edit by hand: change the generator and run it again.
+ *
+ * ssd1306_charmap_latin1 maps a code point to an extended glyph number in
+ * two array lookups: rows[cp/32] selects a 32 entry block (0: none) and the
+ * block holds glyph number + 1 (0: no glyph). font_8x5_ext holds the glyphs
+ * in the same order, in the column format of font_8x5.
+ */
+
+#ifndef _inc_font_ext
+#define _inc_font_ext
+
+#ifndef SSD1306_FONT_ATTR
+#define SSD1306_FONT_ATTR
+#endif
+
+static const uint8_t ssd1306_charmap_latin1_rows[] SSD1306_FONT_ATTR =
+{
+			0, 0, 0, 0, 0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			4, 5, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 8,
+};
+
+static const uint8_t ssd1306_charmap_latin1_blocks[] SSD1306_FONT_ATTR =
+{
+			  1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,
+			 17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,  32,
+			 33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  48,
+			 49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  64,
+			 65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,  80,
+			 81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,  95,  96,
+			  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+			  0,   0,   0,  97,  98,   0,   0,   0,  99, 100,   0,   0, 101, 102,   0,   0,
+			  0,   0, 103,   0,   0,   0, 104,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+			  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+			  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 105,   0,   0,   0,
+			  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+			  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+			106, 107, 108, 109,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+			  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+			  0,   0,   0, 110,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+const ssd1306_charmap_t ssd1306_charmap_latin1 =
+{
+			0x2720, 111, ssd1306_charmap_latin1_rows, ssd1306_charmap_latin1_blocks
+};
+
+static const uint8_t font_8x5_ext[] SSD1306_FONT_ATTR =
+{
+			0x00, 0x00, 0x00, 0x00, 0x00, /* U+00A0 */
+			0x00, 0x00, 0x7D, 0x00, 0x00, /* U+00A1 */
+			0x1C, 0x22, 0x7F, 0x22, 0x00, /* U+00A2 */
+			0x48, 0x7E, 0x49, 0x41, 0x22, /* U+00A3 */
+			0x22, 0x1C, 0x14, 0x1C, 0x22, /* U+00A4 */
+			0x29, 0x2A, 0x7C, 0x2A, 0x29, /* U+00A5 */
+			0x00, 0x00, 0x77, 0x00, 0x00, /* U+00A6 */
+			0x0A, 0x55, 0x55, 0x55, 0x28, /* U+00A7 */
+			0x00, 0x01, 0x00, 0x01, 0x00, /* U+00A8 */
+			0x3E, 0x49, 0x55, 0x55, 0x3E, /* U+00A9 */
+			0x5D, 0x55, 0x5F, 0x00, 0x00, /* U+00AA */
+			0x08, 0x14, 0x2A, 0x14, 0x22, /* U+00AB */
+			0x04, 0x04, 0x04, 0x04, 0x1C, /* U+00AC */
+			0x08, 0x08, 0x08, 0x08, 0x08, /* U+00AD */
+			0x3E, 0x5D, 0x4D, 0x51, 0x3E, /* U+00AE */
+			0x01, 0x01, 0x01, 0x01, 0x01, /* U+00AF */
+			0x06, 0x09, 0x09, 0x06, 0x00, /* U+00B0 */
+			0x44, 0x44, 0x5F, 0x44, 0x44, /* U+00B1 */
+			0x09, 0x0D, 0x0A, 0x00, 0x00, /* U+00B2 */
+			0x11, 0x15, 0x0A, 0x00, 0x00, /* U+00B3 */
+			0x00, 0x00, 0x02, 0x01, 0x00, /* U+00B4 */
+			0xFC, 0x20, 0x20, 0x1C, 0x20, /* U+00B5 */
+			0x06, 0x0F, 0x7F, 0x01, 0x7F, /* U+00B6 */
+			0x00, 0x00, 0x08, 0x00, 0x00, /* U+00B7 */
+			0x00, 0x80, 0xC0, 0x00, 0x00, /* U+00B8 */
+			0x12, 0x1F, 0x10, 0x00, 0x00, /* U+00B9 */
+			0x2F, 0x29, 0x2F, 0x00, 0x00, /* U+00BA */
+			0x22, 0x14, 0x2A, 0x14, 0x08, /* U+00BB */
+			0x27, 0x10, 0x6C, 0xF2, 0x40, /* U+00BC */
+			0x27, 0x10, 0x8C, 0xD2, 0xB0, /* U+00BD */
+			0x25, 0x17, 0x68, 0xF2, 0x40, /* U+00BE */
+			0x30, 0x48, 0x45, 0x40, 0x20, /* U+00BF */
+			0x70, 0x29, 0x26, 0x28, 0x70, /* U+00C0 */
+			0x70, 0x28, 0x26, 0x29, 0x70, /* U+00C1 */
+			0x70, 0x2A, 0x25, 0x2A, 0x70, /* U+00C2 */
+			0x72, 0x29, 0x25, 0x2A, 0x71, /* U+00C3 */
+			0x70, 0x29, 0x24, 0x29, 0x70, /* U+00C4 */
+			0x70, 0x2B, 0x25, 0x2B, 0x70, /* U+00C5 */
+			0x7E, 0x09, 0x7F, 0x49, 0x41, /* U+00C6 */
+			0x38, 0x44, 0xC4, 0xC4, 0x28, /* U+00C7 */
+			0x7C, 0x55, 0x56, 0x54, 0x44, /* U+00C8 */
+			0x7C, 0x54, 0x56, 0x55, 0x44, /* U+00C9 */
+			0x7C, 0x56, 0x55, 0x56, 0x44, /* U+00CA */
+			0x7C, 0x55, 0x54, 0x55, 0x44, /* U+00CB */
+			0x00, 0x45, 0x7E, 0x44, 0x00, /* U+00CC */
+			0x00, 0x44, 0x7E, 0x45, 0x00, /* U+00CD */
+			0x00, 0x46, 0x7D, 0x46, 0x00, /* U+00CE */
+			0x00, 0x45, 0x7C, 0x45, 0x00, /* U+00CF */
+			0x7F, 0x49, 0x49, 0x41, 0x3E, /* U+00D0 */
+			0x7E, 0x09, 0x11, 0x22, 0x7D, /* U+00D1 */
+			0x38, 0x45, 0x46, 0x44, 0x38, /* U+00D2 */
+			0x38, 0x44, 0x46, 0x45, 0x38, /* U+00D3 */
+			0x38, 0x46, 0x45, 0x46, 0x38, /* U+00D4 */
+			0x3A, 0x45, 0x45, 0x46, 0x39, /* U+00D5 */
+			0x38, 0x45, 0x44, 0x45, 0x38, /* U+00D6 */
+			0x22, 0x14, 0x08, 0x14, 0x22, /* U+00D7 */
+			0x3E, 0x61, 0x5D, 0x43, 0x3E, /* U+00D8 */
+			0x3C, 0x41, 0x42, 0x40, 0x3C, /* U+00D9 */
+			0x3C, 0x40, 0x42, 0x41, 0x3C, /* U+00DA */
+			0x3C, 0x42, 0x41, 0x42, 0x3C, /* U+00DB */
+			0x3C, 0x41, 0x40, 0x41, 0x3C, /* U+00DC */
+			0x0C, 0x10, 0x62, 0x11, 0x0C, /* U+00DD */
+			0x7F, 0x12, 0x12, 0x12, 0x0C, /* U+00DE */
+			0x7E, 0x01, 0x49, 0x36, 0x00, /* U+00DF */
+			0x20, 0x55, 0x56, 0x78, 0x40, /* U+00E0 */
+			0x20, 0x54, 0x56, 0x79, 0x40, /* U+00E1 */
+			0x20, 0x56, 0x55, 0x7A, 0x40, /* U+00E2 */
+			0x22, 0x55, 0x55, 0x7A, 0x41, /* U+00E3 */
+			0x20, 0x55, 0x54, 0x79, 0x40, /* U+00E4 */
+			0x20, 0x57, 0x55, 0x7B, 0x40, /* U+00E5 */
+			0x24, 0x54, 0x78, 0x54, 0x58, /* U+00E6 */
+			0x38, 0x44, 0xC4, 0xC4, 0x28, /* U+00E7 */
+			0x38, 0x55, 0x56, 0x54, 0x18, /* U+00E8 */
+			0x38, 0x54, 0x56, 0x55, 0x18, /* U+00E9 */
+			0x38, 0x56, 0x55, 0x56, 0x18, /* U+00EA */
+			0x38, 0x55, 0x54, 0x55, 0x18, /* U+00EB */
+			0x00, 0x45, 0x7E, 0x40, 0x00, /* U+00EC */
+			0x00, 0x44, 0x7E, 0x41, 0x00, /* U+00ED */
+			0x00, 0x46, 0x7D, 0x42, 0x00, /* U+00EE */
+			0x00, 0x45, 0x7C, 0x41, 0x00, /* U+00EF */
+			0x35, 0x4A, 0x4D, 0x48, 0x30, /* U+00F0 */
+			0x7E, 0x09, 0x05, 0x06, 0x79, /* U+00F1 */
+			0x38, 0x45, 0x46, 0x44, 0x38, /* U+00F2 */
+			0x38, 0x44, 0x46, 0x45, 0x38, /* U+00F3 */
+			0x38, 0x46, 0x45, 0x46, 0x38, /* U+00F4 */
+			0x3A, 0x45, 0x45, 0x46, 0x39, /* U+00F5 */
+			0x38, 0x45, 0x44, 0x45, 0x38, /* U+00F6 */
+			0x08, 0x08, 0x2A, 0x08, 0x08, /* U+00F7 */
+			0x78, 0x64, 0x54, 0x4C, 0x3C, /* U+00F8 */
+			0x3C, 0x41, 0x42, 0x20, 0x7C, /* U+00F9 */
+			0x3C, 0x40, 0x42, 0x21, 0x7C, /* U+00FA */
+			0x3C, 0x42, 0x41, 0x22, 0x7C, /* U+00FB */
+			0x3C, 0x41, 0x40, 0x21, 0x7C, /* U+00FC */
+			0x4C, 0x90, 0x92, 0x91, 0x7C, /* U+00FD */
+			0x7F, 0x14, 0x14, 0x14, 0x08, /* U+00FE */
+			0x4C, 0x91, 0x90, 0x91, 0x7C, /* U+00FF */
+			0x08, 0x08, 0x08, 0x08, 0x00, /* U+2013 */
+			0x08, 0x08, 0x08, 0x08, 0x08, /* U+2014 */
+			0x00, 0x06, 0x01, 0x00, 0x00, /* U+2018 */
+			0x00, 0x04, 0x03, 0x00, 0x00, /* U+2019 */
+			0x06, 0x01, 0x06, 0x01, 0x00, /* U+201C */
+			0x04, 0x03, 0x04, 0x03, 0x00, /* U+201D */
+			0x00, 0x1C, 0x1C, 0x1C, 0x00, /* U+2022 */
+			0x40, 0x00, 0x40, 0x00, 0x40, /* U+2026 */
+			0x14, 0x3E, 0x55, 0x55, 0x41, /* U+20AC */
+			0x08, 0x1C, 0x2A, 0x08, 0x08, /* U+2190 */
+			0x04, 0x02, 0x7F, 0x02, 0x04, /* U+2191 */
+			0x08, 0x08, 0x2A, 0x1C, 0x08, /* U+2192 */
+			0x10, 0x20, 0x7F, 0x20, 0x10, /* U+2193 */
+			0x08, 0x10, 0x30, 0x0C, 0x02, /* U+2713 */
+			0x22, 0x14, 0x08, 0x14, 0x22, /* U+2717 */
+};
+
+#endif
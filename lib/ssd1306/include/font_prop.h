@@ -0,0 +1,837 @@
+/*
+ * Proportional fonts generated by tools/fontgen.py from font_8x5.
+ * Do not edit by hand: change the generator and run it again.
+ *
+ * Format (see ssd1306_font_t): one glyph entry per character with the
+ * offset of its first column in the bitmap, its width in columns and its
+ * horizontal advance. Columns are stored top to bottom, <pages> bytes per
+ * column, bit 0 on top. Glyphs first..last are ASCII; the extended glyphs of
+ * ssd1306_charmap_latin1 follow them in charmap order.
+ */
+
+#ifndef _inc_font_prop
+#define _inc_font_prop
+
+#ifndef SSD1306_FONT_ATTR
+#define SSD1306_FONT_ATTR
+#endif
+
+static const ssd1306_glyph_t ssd1306_font_prop8_glyphs[] SSD1306_FONT_ATTR =
+{
+			{    0,  0,  3}, /*   */
+			{    0,  1,  2}, /* ! */
+			{    1,  3,  4}, /* " */
+			{    4,  5,  6}, /* # */
+			{    9,  5,  6}, /* $ */
+			{   14,  5,  6}, /* % */
+			{   19,  5,  6}, /* & */
+			{   24,  3,  4}, /* quote */
+			{   27,  3,  4}, /* ( */
+			{   30,  3,  4}, /* ) */
+			{   33,  5,  6}, /* * */
+			{   38,  5,  6}, /* + */
+			{   43,  3,  4}, /* , */
+			{   46,  5,  6}, /* - */
+			{   51,  2,  3}, /* . */
+			{   53,  5,  6}, /* / */
+			{   58,  5,  6}, /* 0 */
+			{   63,  3,  4}, /* 1 */
+			{   66,  5,  6}, /* 2 */
+			{   71,  5,  6}, /* 3 */
+			{   76,  5,  6}, /* 4 */
+			{   81,  5,  6}, /* 5 */
+			{   86,  5,  6}, /* 6 */
+			{   91,  5,  6}, /* 7 */
+			{   96,  5,  6}, /* 8 */
+			{  101,  5,  6}, /* 9 */
+			{  106,  1,  2}, /* : */
+			{  107,  2,  3}, /* ; */
+			{  109,  4,  5}, /* < */
+			{  113,  5,  6}, /* = */
+			{  118,  4,  5}, /* > */
+			{  122,  5,  6}, /* ? */
+			{  127,  5,  6}, /* @ */
+			{  132,  5,  6}, /* A */
+			{  137,  5,  6}, /* B */
+			{  142,  5,  6}, /* C */
+			{  147,  5,  6}, /* D */
+			{  152,  5,  6}, /* E */
+			{  157,  5,  6}, /* F */
+			{  162,  5,  6}, /* G */
+			{  167,  5,  6}, /* H */
+			{  172,  3,  4}, /* I */
+			{  175,  5,  6}, /* J */
+			{  180,  5,  6}, /* K */
+			{  185,  5,  6}, /* L */
+			{  190,  5,  6}, /* M */
+			{  195,  5,  6}, /* N */
+			{  200,  5,  6}, /* O */
+			{  205,  5,  6}, /* P */
+			{  210,  5,  6}, /* Q */
+			{  215,  5,  6}, /* R */
+			{  220,  5,  6}, /* S */
+			{  225,  5,  6}, /* T */
+			{  230,  5,  6}, /* U */
+			{  235,  5,  6}, /* V */
+			{  240,  5,  6}, /* W */
+			{  245,  5,  6}, /* X */
+			{  250,  5,  6}, /* Y */
+			{  255,  5,  6}, /* Z */
+			{  260,  4,  5}, /* [ */
+			{  264,  5,  6}, /* backslash */
+			{  269,  4,  5}, /* ] */
+			{  273,  5,  6}, /* ^ */
+			{  278,  5,  6}, /* _ */
+			{  283,  3,  4}, /* ` */
+			{  286,  5,  6}, /* a */
+			{  291,  5,  6}, /* b */
+			{  296,  5,  6}, /* c */
+			{  301,  5,  6}, /* d */
+			{  306,  5,  6}, /* e */
+			{  311,  4,  5}, /* f */
+			{  315,  5,  6}, /* g */
+			{  320,  5,  6}, /* h */
+			{  325,  3,  4}, /* i */
+			{  328,  4,  5}, /* j */
+			{  332,  4,  5}, /* k */
+			{  336,  3,  4}, /* l */
+			{  339,  5,  6}, /* m */
+			{  344,  5,  6}, /* n */
+			{  349,  5,  6}, /* o */
+			{  354,  5,  6}, /* p */
+			{  359,  5,  6}, /* q */
+			{  364,  5,  6}, /* r */
+			{  369,  5,  6}, /* s */
+			{  374,  5,  6}, /* t */
+			{  379,  5,  6}, /* u */
+			{  384,  5,  6}, /* v */
+			{  389,  5,  6}, /* w */
+			{  394,  5,  6}, /* x */
+			{  399,  5,  6}, /* y */
+			{  404,  5,  6}, /* z */
+			{  409,  3,  4}, /* { */
+			{  412,  1,  2}, /* | */
+			{  413,  3,  4}, /* } */
+			{  416,  5,  6}, /* ~ */
+			{  421,  0,  3}, /* U+00A0 */
+			{  421,  1,  2}, /* U+00A1 */
+			{  422,  4,  5}, /* U+00A2 */
+			{  426,  5,  6}, /* U+00A3 */
+			{  431,  5,  6}, /* U+00A4 */
+			{  436,  5,  6}, /* U+00A5 */
+			{  441,  1,  2}, /* U+00A6 */
+			{  442,  5,  6}, /* U+00A7 */
+			{  447,  3,  4}, /* U+00A8 */
+			{  450,  5,  6}, /* U+00A9 */
+			{  455,  3,  4}, /* U+00AA */
+			{  458,  5,  6}, /* U+00AB */
+			{  463,  5,  6}, /* U+00AC */
+			{  468,  5,  6}, /* U+00AD */
+			{  473,  5,  6}, /* U+00AE */
+			{  478,  5,  6}, /* U+00AF */
+			{  483,  4,  5}, /* U+00B0 */
+			{  487,  5,  6}, /* U+00B1 */
+			{  492,  3,  4}, /* U+00B2 */
+			{  495,  3,  4}, /* U+00B3 */
+			{  498,  2,  3}, /* U+00B4 */
+			{  500,  5,  6}, /* U+00B5 */
+			{  505,  5,  6}, /* U+00B6 */
+			{  510,  1,  2}, /* U+00B7 */
+			{  511,  2,  3}, /* U+00B8 */
+			{  513,  3,  4}, /* U+00B9 */
+			{  516,  3,  4}, /* U+00BA */
+			{  519,  5,  6}, /* U+00BB */
+			{  524,  5,  6}, /* U+00BC */
+			{  529,  5,  6}, /* U+00BD */
+			{  534,  5,  6}, /* U+00BE */
+			{  539,  5,  6}, /* U+00BF */
+			{  544,  5,  6}, /* U+00C0 */
+			{  549,  5,  6}, /* U+00C1 */
+			{  554,  5,  6}, /* U+00C2 */
+			{  559,  5,  6}, /* U+00C3 */
+			{  564,  5,  6}, /* U+00C4 */
+			{  569,  5,  6}, /* U+00C5 */
+			{  574,  5,  6}, /* U+00C6 */
+			{  579,  5,  6}, /* U+00C7 */
+			{  584,  5,  6}, /* U+00C8 */
+			{  589,  5,  6}, /* U+00C9 */
+			{  594,  5,  6}, /* U+00CA */
+			{  599,  5,  6}, /* U+00CB */
+			{  604,  3,  4}, /* U+00CC */
+			{  607,  3,  4}, /* U+00CD */
+			{  610,  3,  4}, /* U+00CE */
+			{  613,  3,  4}, /* U+00CF */
+			{  616,  5,  6}, /* U+00D0 */
+			{  621,  5,  6}, /* U+00D1 */
+			{  626,  5,  6}, /* U+00D2 */
+			{  631,  5,  6}, /* U+00D3 */
+			{  636,  5,  6}, /* U+00D4 */
+			{  641,  5,  6}, /* U+00D5 */
+			{  646,  5,  6}, /* U+00D6 */
+			{  651,  5,  6}, /* U+00D7 */
+			{  656,  5,  6}, /* U+00D8 */
+			{  661,  5,  6}, /* U+00D9 */
+			{  666,  5,  6}, /* U+00DA */
+			{  671,  5,  6}, /* U+00DB */
+			{  676,  5,  6}, /* U+00DC */
+			{  681,  5,  6}, /* U+00DD */
+			{  686,  5,  6}, /* U+00DE */
+			{  691,  4,  5}, /* U+00DF */
+			{  695,  5,  6}, /* U+00E0 */
+			{  700,  5,  6}, /* U+00E1 */
+			{  705,  5,  6}, /* U+00E2 */
+			{  710,  5,  6}, /* U+00E3 */
+			{  715,  5,  6}, /* U+00E4 */
+			{  720,  5,  6}, /* U+00E5 */
+			{  725,  5,  6}, /* U+00E6 */
+			{  730,  5,  6}, /* U+00E7 */
+			{  735,  5,  6}, /* U+00E8 */
+			{  740,  5,  6}, /* U+00E9 */
+			{  745,  5,  6}, /* U+00EA */
+			{  750,  5,  6}, /* U+00EB */
+			{  755,  3,  4}, /* U+00EC */
+			{  758,  3,  4}, /* U+00ED */
+			{  761,  3,  4}, /* U+00EE */
+			{  764,  3,  4}, /* U+00EF */
+			{  767,  5,  6}, /* U+00F0 */
+			{  772,  5,  6}, /* U+00F1 */
+			{  777,  5,  6}, /* U+00F2 */
+			{  782,  5,  6}, /* U+00F3 */
+			{  787,  5,  6}, /* U+00F4 */
+			{  792,  5,  6}, /* U+00F5 */
+			{  797,  5,  6}, /* U+00F6 */
+			{  802,  5,  6}, /* U+00F7 */
+			{  807,  5,  6}, /* U+00F8 */
+			{  812,  5,  6}, /* U+00F9 */
+			{  817,  5,  6}, /* U+00FA */
+			{  822,  5,  6}, /* U+00FB */
+			{  827,  5,  6}, /* U+00FC */
+			{  832,  5,  6}, /* U+00FD */
+			{  837,  5,  6}, /* U+00FE */
+			{  842,  5,  6}, /* U+00FF */
+			{  847,  4,  5}, /* U+2013 */
+			{  851,  5,  6}, /* U+2014 */
+			{  856,  2,  3}, /* U+2018 */
+			{  858,  2,  3}, /* U+2019 */
+			{  860,  4,  5}, /* U+201C */
+			{  864,  4,  5}, /* U+201D */
+			{  868,  3,  4}, /* U+2022 */
+			{  871,  5,  6}, /* U+2026 */
+			{  876,  5,  6}, /* U+20AC */
+			{  881,  5,  6}, /* U+2190 */
+			{  886,  5,  6}, /* U+2191 */
+			{  891,  5,  6}, /* U+2192 */
+			{  896,  5,  6}, /* U+2193 */
+			{  901,  5,  6}, /* U+2713 */
+			{  906,  5,  6}, /* U+2717 */
+};
+
+static const uint8_t ssd1306_font_prop8_bitmap[] SSD1306_FONT_ATTR =
+{
+			0x5F, 0x07, 0x00, 0x07, 0x14, 0x7F, 0x14, 0x7F, 0x14, 0x24, 0x2A, 0x7F,
+			0x2A, 0x12, 0x23, 0x13, 0x08, 0x64, 0x62, 0x36, 0x49, 0x56, 0x20, 0x50,
+			0x08, 0x07, 0x03, 0x1C, 0x22, 0x41, 0x41, 0x22, 0x1C, 0x2A, 0x1C, 0x7F,
+			0x1C, 0x2A, 0x08, 0x08, 0x3E, 0x08, 0x08, 0x80, 0x70, 0x30, 0x08, 0x08,
+			0x08, 0x08, 0x08, 0x60, 0x60, 0x20, 0x10, 0x08, 0x04, 0x02, 0x3E, 0x51,
+			0x49, 0x45, 0x3E, 0x42, 0x7F, 0x40, 0x72, 0x49, 0x49, 0x49, 0x46, 0x21,
+			0x41, 0x49, 0x4D, 0x33, 0x18, 0x14, 0x12, 0x7F, 0x10, 0x27, 0x45, 0x45,
+			0x45, 0x39, 0x3C, 0x4A, 0x49, 0x49, 0x31, 0x41, 0x21, 0x11, 0x09, 0x07,
+			0x36, 0x49, 0x49, 0x49, 0x36, 0x46, 0x49, 0x49, 0x29, 0x1E, 0x14, 0x40,
+			0x34, 0x08, 0x14, 0x22, 0x41, 0x14, 0x14, 0x14, 0x14, 0x14, 0x41, 0x22,
+			0x14, 0x08, 0x02, 0x01, 0x59, 0x09, 0x06, 0x3E, 0x41, 0x5D, 0x59, 0x4E,
+			0x7C, 0x12, 0x11, 0x12, 0x7C, 0x7F, 0x49, 0x49, 0x49, 0x36, 0x3E, 0x41,
+			0x41, 0x41, 0x22, 0x7F, 0x41, 0x41, 0x41, 0x3E, 0x7F, 0x49, 0x49, 0x49,
+			0x41, 0x7F, 0x09, 0x09, 0x09, 0x01, 0x3E, 0x41, 0x41, 0x51, 0x73, 0x7F,
+			0x08, 0x08, 0x08, 0x7F, 0x41, 0x7F, 0x41, 0x20, 0x40, 0x41, 0x3F, 0x01,
+			0x7F, 0x08, 0x14, 0x22, 0x41, 0x7F, 0x40, 0x40, 0x40, 0x40, 0x7F, 0x02,
+			0x1C, 0x02, 0x7F, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x3E, 0x41, 0x41, 0x41,
+			0x3E, 0x7F, 0x09, 0x09, 0x09, 0x06, 0x3E, 0x41, 0x51, 0x21, 0x5E, 0x7F,
+			0x09, 0x19, 0x29, 0x46, 0x26, 0x49, 0x49, 0x49, 0x32, 0x03, 0x01, 0x7F,
+			0x01, 0x03, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x1F, 0x20, 0x40, 0x20, 0x1F,
+			0x3F, 0x40, 0x38, 0x40, 0x3F, 0x63, 0x14, 0x08, 0x14, 0x63, 0x03, 0x04,
+			0x78, 0x04, 0x03, 0x61, 0x59, 0x49, 0x4D, 0x43, 0x7F, 0x41, 0x41, 0x41,
+			0x02, 0x04, 0x08, 0x10, 0x20, 0x41, 0x41, 0x41, 0x7F, 0x04, 0x02, 0x01,
+			0x02, 0x04, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0x07, 0x08, 0x20, 0x54,
+			0x54, 0x78, 0x40, 0x7F, 0x28, 0x44, 0x44, 0x38, 0x38, 0x44, 0x44, 0x44,
+			0x28, 0x38, 0x44, 0x44, 0x28, 0x7F, 0x38, 0x54, 0x54, 0x54, 0x18, 0x08,
+			0x7E, 0x09, 0x02, 0x18, 0xA4, 0xA4, 0x9C, 0x78, 0x7F, 0x08, 0x04, 0x04,
+			0x78, 0x44, 0x7D, 0x40, 0x20, 0x40, 0x40, 0x3D, 0x7F, 0x10, 0x28, 0x44,
+			0x41, 0x7F, 0x40, 0x7C, 0x04, 0x78, 0x04, 0x78, 0x7C, 0x08, 0x04, 0x04,
+			0x78, 0x38, 0x44, 0x44, 0x44, 0x38, 0xFC, 0x18, 0x24, 0x24, 0x18, 0x18,
+			0x24, 0x24, 0x18, 0xFC, 0x7C, 0x08, 0x04, 0x04, 0x08, 0x48, 0x54, 0x54,
+			0x54, 0x24, 0x04, 0x04, 0x3F, 0x44, 0x24, 0x3C, 0x40, 0x40, 0x20, 0x7C,
+			0x1C, 0x20, 0x40, 0x20, 0x1C, 0x3C, 0x40, 0x30, 0x40, 0x3C, 0x44, 0x28,
+			0x10, 0x28, 0x44, 0x4C, 0x90, 0x90, 0x90, 0x7C, 0x44, 0x64, 0x54, 0x4C,
+			0x44, 0x08, 0x36, 0x41, 0x77, 0x41, 0x36, 0x08, 0x02, 0x01, 0x02, 0x04,
+			0x02, 0x7D, 0x1C, 0x22, 0x7F, 0x22, 0x48, 0x7E, 0x49, 0x41, 0x22, 0x22,
+			0x1C, 0x14, 0x1C, 0x22, 0x29, 0x2A, 0x7C, 0x2A, 0x29, 0x77, 0x0A, 0x55,
+			0x55, 0x55, 0x28, 0x01, 0x00, 0x01, 0x3E, 0x49, 0x55, 0x55, 0x3E, 0x5D,
+			0x55, 0x5F, 0x08, 0x14, 0x2A, 0x14, 0x22, 0x04, 0x04, 0x04, 0x04, 0x1C,
+			0x08, 0x08, 0x08, 0x08, 0x08, 0x3E, 0x5D, 0x4D, 0x51, 0x3E, 0x01, 0x01,
+			0x01, 0x01, 0x01, 0x06, 0x09, 0x09, 0x06, 0x44, 0x44, 0x5F, 0x44, 0x44,
+			0x09, 0x0D, 0x0A, 0x11, 0x15, 0x0A, 0x02, 0x01, 0xFC, 0x20, 0x20, 0x1C,
+			0x20, 0x06, 0x0F, 0x7F, 0x01, 0x7F, 0x08, 0x80, 0xC0, 0x12, 0x1F, 0x10,
+			0x2F, 0x29, 0x2F, 0x22, 0x14, 0x2A, 0x14, 0x08, 0x27, 0x10, 0x6C, 0xF2,
+			0x40, 0x27, 0x10, 0x8C, 0xD2, 0xB0, 0x25, 0x17, 0x68, 0xF2, 0x40, 0x30,
+			0x48, 0x45, 0x40, 0x20, 0x70, 0x29, 0x26, 0x28, 0x70, 0x70, 0x28, 0x26,
+			0x29, 0x70, 0x70, 0x2A, 0x25, 0x2A, 0x70, 0x72, 0x29, 0x25, 0x2A, 0x71,
+			0x70, 0x29, 0x24, 0x29, 0x70, 0x70, 0x2B, 0x25, 0x2B, 0x70, 0x7E, 0x09,
+			0x7F, 0x49, 0x41, 0x38, 0x44, 0xC4, 0xC4, 0x28, 0x7C, 0x55, 0x56, 0x54,
+			0x44, 0x7C, 0x54, 0x56, 0x55, 0x44, 0x7C, 0x56, 0x55, 0x56, 0x44, 0x7C,
+			0x55, 0x54, 0x55, 0x44, 0x45, 0x7E, 0x44, 0x44, 0x7E, 0x45, 0x46, 0x7D,
+			0x46, 0x45, 0x7C, 0x45, 0x7F, 0x49, 0x49, 0x41, 0x3E, 0x7E, 0x09, 0x11,
+			0x22, 0x7D, 0x38, 0x45, 0x46, 0x44, 0x38, 0x38, 0x44, 0x46, 0x45, 0x38,
+			0x38, 0x46, 0x45, 0x46, 0x38, 0x3A, 0x45, 0x45, 0x46, 0x39, 0x38, 0x45,
+			0x44, 0x45, 0x38, 0x22, 0x14, 0x08, 0x14, 0x22, 0x3E, 0x61, 0x5D, 0x43,
+			0x3E, 0x3C, 0x41, 0x42, 0x40, 0x3C, 0x3C, 0x40, 0x42, 0x41, 0x3C, 0x3C,
+			0x42, 0x41, 0x42, 0x3C, 0x3C, 0x41, 0x40, 0x41, 0x3C, 0x0C, 0x10, 0x62,
+			0x11, 0x0C, 0x7F, 0x12, 0x12, 0x12, 0x0C, 0x7E, 0x01, 0x49, 0x36, 0x20,
+			0x55, 0x56, 0x78, 0x40, 0x20, 0x54, 0x56, 0x79, 0x40, 0x20, 0x56, 0x55,
+			0x7A, 0x40, 0x22, 0x55, 0x55, 0x7A, 0x41, 0x20, 0x55, 0x54, 0x79, 0x40,
+			0x20, 0x57, 0x55, 0x7B, 0x40, 0x24, 0x54, 0x78, 0x54, 0x58, 0x38, 0x44,
+			0xC4, 0xC4, 0x28, 0x38, 0x55, 0x56, 0x54, 0x18, 0x38, 0x54, 0x56, 0x55,
+			0x18, 0x38, 0x56, 0x55, 0x56, 0x18, 0x38, 0x55, 0x54, 0x55, 0x18, 0x45,
+			0x7E, 0x40, 0x44, 0x7E, 0x41, 0x46, 0x7D, 0x42, 0x45, 0x7C, 0x41, 0x35,
+			0x4A, 0x4D, 0x48, 0x30, 0x7E, 0x09, 0x05, 0x06, 0x79, 0x38, 0x45, 0x46,
+			0x44, 0x38, 0x38, 0x44, 0x46, 0x45, 0x38, 0x38, 0x46, 0x45, 0x46, 0x38,
+			0x3A, 0x45, 0x45, 0x46, 0x39, 0x38, 0x45, 0x44, 0x45, 0x38, 0x08, 0x08,
+			0x2A, 0x08, 0x08, 0x78, 0x64, 0x54, 0x4C, 0x3C, 0x3C, 0x41, 0x42, 0x20,
+			0x7C, 0x3C, 0x40, 0x42, 0x21, 0x7C, 0x3C, 0x42, 0x41, 0x22, 0x7C, 0x3C,
+			0x41, 0x40, 0x21, 0x7C, 0x4C, 0x90, 0x92, 0x91, 0x7C, 0x7F, 0x14, 0x14,
+			0x14, 0x08, 0x4C, 0x91, 0x90, 0x91, 0x7C, 0x08, 0x08, 0x08, 0x08, 0x08,
+			0x08, 0x08, 0x08, 0x08, 0x06, 0x01, 0x04, 0x03, 0x06, 0x01, 0x06, 0x01,
+			0x04, 0x03, 0x04, 0x03, 0x1C, 0x1C, 0x1C, 0x40, 0x00, 0x40, 0x00, 0x40,
+			0x14, 0x3E, 0x55, 0x55, 0x41, 0x08, 0x1C, 0x2A, 0x08, 0x08, 0x04, 0x02,
+			0x7F, 0x02, 0x04, 0x08, 0x08, 0x2A, 0x1C, 0x08, 0x10, 0x20, 0x7F, 0x20,
+			0x10, 0x08, 0x10, 0x30, 0x0C, 0x02, 0x22, 0x14, 0x08, 0x14, 0x22,
+};
+
+const ssd1306_font_t ssd1306_font_prop8 =
+{
+			8, 1, 32, 126, ssd1306_font_prop8_glyphs, ssd1306_font_prop8_bitmap, &ssd1306_charmap_latin1
+};
+
+static const ssd1306_glyph_t ssd1306_font_prop16_glyphs[] SSD1306_FONT_ATTR =
+{
+			{    0,  0,  6}, /*   */
+			{    0,  2,  4}, /* ! */
+			{    2,  6,  8}, /* " */
+			{    8, 10, 12}, /* # */
+			{   18, 10, 12}, /* $ */
+			{   28, 10, 12}, /* % */
+			{   38, 10, 12}, /* & */
+			{   48,  6,  8}, /* quote */
+			{   54,  6,  8}, /* ( */
+			{   60,  6,  8}, /* ) */
+			{   66, 10, 12}, /* * */
+			{   76, 10, 12}, /* + */
+			{   86,  6,  8}, /* , */
+			{   92, 10, 12}, /* - */
+			{  102,  4,  6}, /* . */
+			{  106, 10, 12}, /* / */
+			{  116, 10, 12}, /* 0 */
+			{  126,  6,  8}, /* 1 */
+			{  132, 10, 12}, /* 2 */
+			{  142, 10, 12}, /* 3 */
+			{  152, 10, 12}, /* 4 */
+			{  162, 10, 12}, /* 5 */
+			{  172, 10, 12}, /* 6 */
+			{  182, 10, 12}, /* 7 */
+			{  192, 10, 12}, /* 8 */
+			{  202, 10, 12}, /* 9 */
+			{  212,  2,  4}, /* : */
+			{  214,  4,  6}, /* ; */
+			{  218,  8, 10}, /* < */
+			{  226, 10, 12}, /* = */
+			{  236,  8, 10}, /* > */
+			{  244, 10, 12}, /* ? */
+			{  254, 10, 12}, /* @ */
+			{  264, 10, 12}, /* A */
+			{  274, 10, 12}, /* B */
+			{  284, 10, 12}, /* C */
+			{  294, 10, 12}, /* D */
+			{  304, 10, 12}, /* E */
+			{  314, 10, 12}, /* F */
+			{  324, 10, 12}, /* G */
+			{  334, 10, 12}, /* H */
+			{  344,  6,  8}, /* I */
+			{  350, 10, 12}, /* J */
+			{  360, 10, 12}, /* K */
+			{  370, 10, 12}, /* L */
+			{  380, 10, 12}, /* M */
+			{  390, 10, 12}, /* N */
+			{  400, 10, 12}, /* O */
+			{  410, 10, 12}, /* P */
+			{  420, 10, 12}, /* Q */
+			{  430, 10, 12}, /* R */
+			{  440, 10, 12}, /* S */
+			{  450, 10, 12}, /* T */
+			{  460, 10, 12}, /* U */
+			{  470, 10, 12}, /* V */
+			{  480, 10, 12}, /* W */
+			{  490, 10, 12}, /* X */
+			{  500, 10, 12}, /* Y */
+			{  510, 10, 12}, /* Z */
+			{  520,  8, 10}, /* [ */
+			{  528, 10, 12}, /* backslash */
+			{  538,  8, 10}, /* ] */
+			{  546, 10, 12}, /* ^ */
+			{  556, 10, 12}, /* _ */
+			{  566,  6,  8}, /* ` */
+			{  572, 10, 12}, /* a */
+			{  582, 10, 12}, /* b */
+			{  592, 10, 12}, /* c */
+			{  602, 10, 12}, /* d */
+			{  612, 10, 12}, /* e */
+			{  622,  8, 10}, /* f */
+			{  630, 10, 12}, /* g */
+			{  640, 10, 12}, /* h */
+			{  650,  6,  8}, /* i */
+			{  656,  8, 10}, /* j */
+			{  664,  8, 10}, /* k */
+			{  672,  6,  8}, /* l */
+			{  678, 10, 12}, /* m */
+			{  688, 10, 12}, /* n */
+			{  698, 10, 12}, /* o */
+			{  708, 10, 12}, /* p */
+			{  718, 10, 12}, /* q */
+			{  728, 10, 12}, /* r */
+			{  738, 10, 12}, /* s */
+			{  748, 10, 12}, /* t */
+			{  758, 10, 12}, /* u */
+			{  768, 10, 12}, /* v */
+			{  778, 10, 12}, /* w */
+			{  788, 10, 12}, /* x */
+			{  798, 10, 12}, /* y */
+			{  808, 10, 12}, /* z */
+			{  818,  6,  8}, /* { */
+			{  824,  2,  4}, /* | */
+			{  826,  6,  8}, /* } */
+			{  832, 10, 12}, /* ~ */
+			{  842,  0,  6}, /* U+00A0 */
+			{  842,  2,  4}, /* U+00A1 */
+			{  844,  8, 10}, /* U+00A2 */
+			{  852, 10, 12}, /* U+00A3 */
+			{  862, 10, 12}, /* U+00A4 */
+			{  872, 10, 12}, /* U+00A5 */
+			{  882,  2,  4}, /* U+00A6 */
+			{  884, 10, 12}, /* U+00A7 */
+			{  894,  6,  8}, /* U+00A8 */
+			{  900, 10, 12}, /* U+00A9 */
+			{  910,  6,  8}, /* U+00AA */
+			{  916, 10, 12}, /* U+00AB */
+			{  926, 10, 12}, /* U+00AC */
+			{  936, 10, 12}, /* U+00AD */
+			{  946, 10, 12}, /* U+00AE */
+			{  956, 10, 12}, /* U+00AF */
+			{  966,  8, 10}, /* U+00B0 */
+			{  974, 10, 12}, /* U+00B1 */
+			{  984,  6,  8}, /* U+00B2 */
+			{  990,  6,  8}, /* U+00B3 */
+			{  996,  4,  6}, /* U+00B4 */
+			{ 1000, 10, 12}, /* U+00B5 */
+			{ 1010, 10, 12}, /* U+00B6 */
+			{ 1020,  2,  4}, /* U+00B7 */
+			{ 1022,  4,  6}, /* U+00B8 */
+			{ 1026,  6,  8}, /* U+00B9 */
+			{ 1032,  6,  8}, /* U+00BA */
+			{ 1038, 10, 12}, /* U+00BB */
+			{ 1048, 10, 12}, /* U+00BC */
+			{ 1058, 10, 12}, /* U+00BD */
+			{ 1068, 10, 12}, /* U+00BE */
+			{ 1078, 10, 12}, /* U+00BF */
+			{ 1088, 10, 12}, /* U+00C0 */
+			{ 1098, 10, 12}, /* U+00C1 */
+			{ 1108, 10, 12}, /* U+00C2 */
+			{ 1118, 10, 12}, /* U+00C3 */
+			{ 1128, 10, 12}, /* U+00C4 */
+			{ 1138, 10, 12}, /* U+00C5 */
+			{ 1148, 10, 12}, /* U+00C6 */
+			{ 1158, 10, 12}, /* U+00C7 */
+			{ 1168, 10, 12}, /* U+00C8 */
+			{ 1178, 10, 12}, /* U+00C9 */
+			{ 1188, 10, 12}, /* U+00CA */
+			{ 1198, 10, 12}, /* U+00CB */
+			{ 1208,  6,  8}, /* U+00CC */
+			{ 1214,  6,  8}, /* U+00CD */
+			{ 1220,  6,  8}, /* U+00CE */
+			{ 1226,  6,  8}, /* U+00CF */
+			{ 1232, 10, 12}, /* U+00D0 */
+			{ 1242, 10, 12}, /* U+00D1 */
+			{ 1252, 10, 12}, /* U+00D2 */
+			{ 1262, 10, 12}, /* U+00D3 */
+			{ 1272, 10, 12}, /* U+00D4 */
+			{ 1282, 10, 12}, /* U+00D5 */
+			{ 1292, 10, 12}, /* U+00D6 */
+			{ 1302, 10, 12}, /* U+00D7 */
+			{ 1312, 10, 12}, /* U+00D8 */
+			{ 1322, 10, 12}, /* U+00D9 */
+			{ 1332, 10, 12}, /* U+00DA */
+			{ 1342, 10, 12}, /* U+00DB */
+			{ 1352, 10, 12}, /* U+00DC */
+			{ 1362, 10, 12}, /* U+00DD */
+			{ 1372, 10, 12}, /* U+00DE */
+			{ 1382,  8, 10}, /* U+00DF */
+			{ 1390, 10, 12}, /* U+00E0 */
+			{ 1400, 10, 12}, /* U+00E1 */
+			{ 1410, 10, 12}, /* U+00E2 */
+			{ 1420, 10, 12}, /* U+00E3 */
+			{ 1430, 10, 12}, /* U+00E4 */
+			{ 1440, 10, 12}, /* U+00E5 */
+			{ 1450, 10, 12}, /* U+00E6 */
+			{ 1460, 10, 12}, /* U+00E7 */
+			{ 1470, 10, 12}, /* U+00E8 */
+			{ 1480, 10, 12}, /* U+00E9 */
+			{ 1490, 10, 12}, /* U+00EA */
+			{ 1500, 10, 12}, /* U+00EB */
+			{ 1510,  6,  8}, /* U+00EC */
+			{ 1516,  6,  8}, /* U+00ED */
+			{ 1522,  6,  8}, /* U+00EE */
+			{ 1528,  6,  8}, /* U+00EF */
+			{ 1534, 10, 12}, /* U+00F0 */
+			{ 1544, 10, 12}, /* U+00F1 */
+			{ 1554, 10, 12}, /* U+00F2 */
+			{ 1564, 10, 12}, /* U+00F3 */
+			{ 1574, 10, 12}, /* U+00F4 */
+			{ 1584, 10, 12}, /* U+00F5 */
+			{ 1594, 10, 12}, /* U+00F6 */
+			{ 1604, 10, 12}, /* U+00F7 */
+			{ 1614, 10, 12}, /* U+00F8 */
+			{ 1624, 10, 12}, /* U+00F9 */
+			{ 1634, 10, 12}, /* U+00FA */
+			{ 1644, 10, 12}, /* U+00FB */
+			{ 1654, 10, 12}, /* U+00FC */
+			{ 1664, 10, 12}, /* U+00FD */
+			{ 1674, 10, 12}, /* U+00FE */
+			{ 1684, 10, 12}, /* U+00FF */
+			{ 1694,  8, 10}, /* U+2013 */
+			{ 1702, 10, 12}, /* U+2014 */
+			{ 1712,  4,  6}, /* U+2018 */
+			{ 1716,  4,  6}, /* U+2019 */
+			{ 1720,  8, 10}, /* U+201C */
+			{ 1728,  8, 10}, /* U+201D */
+			{ 1736,  6,  8}, /* U+2022 */
+			{ 1742, 10, 12}, /* U+2026 */
+			{ 1752, 10, 12}, /* U+20AC */
+			{ 1762, 10, 12}, /* U+2190 */
+			{ 1772, 10, 12}, /* U+2191 */
+			{ 1782, 10, 12}, /* U+2192 */
+			{ 1792, 10, 12}, /* U+2193 */
+			{ 1802, 10, 12}, /* U+2713 */
+			{ 1812, 10, 12}, /* U+2717 */
+};
+
+static const uint8_t ssd1306_font_prop16_bitmap[] SSD1306_FONT_ATTR =
+{
+			0xFF, 0x33, 0xFF, 0x33, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x3F, 0x00, 0x3F, 0x00, 0x30, 0x03, 0x38, 0x07, 0xFF, 0x3F, 0xFF, 0x3F,
+			0x30, 0x03, 0x30, 0x03, 0xFF, 0x3F, 0xFF, 0x3F, 0x38, 0x07, 0x30, 0x03,
+			0x30, 0x0C, 0x78, 0x0C, 0xCC, 0x0C, 0xCE, 0x1C, 0xFF, 0x3F, 0xFF, 0x3F,
+			0xCE, 0x1C, 0xCC, 0x0C, 0x8C, 0x07, 0x0C, 0x03, 0x06, 0x0C, 0x0F, 0x0E,
+			0x0F, 0x07, 0x86, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x70, 0x18, 0x38, 0x3C,
+			0x1C, 0x3C, 0x0C, 0x18, 0x3C, 0x0F, 0x3E, 0x1F, 0xC3, 0x38, 0xC3, 0x30,
+			0x3E, 0x33, 0x3C, 0x33, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x33, 0x00, 0x33,
+			0xC0, 0x00, 0xE0, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x06, 0x00,
+			0xF0, 0x03, 0xF8, 0x07, 0x1C, 0x0E, 0x0E, 0x1C, 0x07, 0x38, 0x03, 0x30,
+			0x03, 0x30, 0x07, 0x38, 0x0E, 0x1C, 0x1C, 0x0E, 0xF8, 0x07, 0xF0, 0x03,
+			0xCC, 0x0C, 0xCC, 0x0C, 0xE0, 0x01, 0xF0, 0x03, 0xFF, 0x3F, 0xFF, 0x3F,
+			0xF0, 0x03, 0xE0, 0x01, 0xCC, 0x0C, 0xCC, 0x0C, 0xC0, 0x00, 0xC0, 0x00,
+			0xC0, 0x00, 0xE0, 0x01, 0xFC, 0x0F, 0xFC, 0x0F, 0xE0, 0x01, 0xC0, 0x00,
+			0xC0, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x7E, 0x00, 0x3F,
+			0x00, 0x1F, 0x00, 0x06, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+			0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+			0x00, 0x18, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0E,
+			0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00,
+			0x1C, 0x00, 0x0C, 0x00, 0xFC, 0x0F, 0xFE, 0x1F, 0x07, 0x33, 0x03, 0x33,
+			0xC3, 0x31, 0xE3, 0x30, 0x33, 0x30, 0x33, 0x38, 0xFE, 0x1F, 0xFC, 0x0F,
+			0x0C, 0x30, 0x1E, 0x38, 0xFF, 0x3F, 0xFF, 0x3F, 0x00, 0x38, 0x00, 0x30,
+			0x0C, 0x1F, 0x8E, 0x3F, 0xC7, 0x39, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30,
+			0xC3, 0x30, 0xE7, 0x30, 0x7E, 0x30, 0x3C, 0x30, 0x03, 0x0C, 0x03, 0x1C,
+			0x03, 0x38, 0x03, 0x30, 0xC3, 0x30, 0xE3, 0x30, 0xF3, 0x30, 0x73, 0x39,
+			0x9F, 0x1F, 0x0E, 0x0F, 0xC0, 0x01, 0xE0, 0x03, 0x30, 0x03, 0x38, 0x03,
+			0x0C, 0x03, 0x8E, 0x07, 0xFF, 0x3F, 0xFF, 0x3F, 0x80, 0x07, 0x00, 0x03,
+			0x1E, 0x0C, 0x3F, 0x1C, 0x33, 0x38, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30,
+			0x33, 0x30, 0x73, 0x38, 0xE3, 0x1F, 0xC3, 0x0F, 0xF0, 0x0F, 0xF8, 0x1F,
+			0xCC, 0x39, 0xCE, 0x30, 0xC7, 0x30, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x39,
+			0x83, 0x1F, 0x03, 0x0F, 0x03, 0x30, 0x03, 0x38, 0x03, 0x1C, 0x03, 0x0E,
+			0x03, 0x07, 0x83, 0x03, 0xC3, 0x01, 0xE7, 0x00, 0x7F, 0x00, 0x3E, 0x00,
+			0x3C, 0x0F, 0x3E, 0x1F, 0xE7, 0x39, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30,
+			0xC3, 0x30, 0xE7, 0x39, 0x3E, 0x1F, 0x3C, 0x0F, 0x3C, 0x30, 0x7E, 0x30,
+			0xE7, 0x30, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x38, 0xC3, 0x1C, 0xE7, 0x0C,
+			0xFE, 0x07, 0xFC, 0x03, 0x30, 0x03, 0x30, 0x03, 0x00, 0x30, 0x00, 0x38,
+			0x30, 0x1F, 0x30, 0x0F, 0xC0, 0x00, 0xE0, 0x01, 0x30, 0x03, 0x38, 0x07,
+			0x1C, 0x0E, 0x0E, 0x1C, 0x07, 0x38, 0x03, 0x30, 0x30, 0x03, 0x30, 0x03,
+			0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03,
+			0x30, 0x03, 0x30, 0x03, 0x03, 0x30, 0x07, 0x38, 0x0E, 0x1C, 0x1C, 0x0E,
+			0x38, 0x07, 0x30, 0x03, 0xE0, 0x01, 0xC0, 0x00, 0x0C, 0x00, 0x0E, 0x00,
+			0x07, 0x00, 0x03, 0x00, 0x83, 0x33, 0xC3, 0x33, 0xC3, 0x01, 0xE7, 0x00,
+			0x7E, 0x00, 0x3C, 0x00, 0xFC, 0x0F, 0xFE, 0x1F, 0x07, 0x38, 0x03, 0x30,
+			0xF3, 0x31, 0xF3, 0x33, 0xC3, 0x33, 0xC7, 0x31, 0xFE, 0x31, 0x7C, 0x30,
+			0xF0, 0x3F, 0xF8, 0x3F, 0x9C, 0x07, 0x0E, 0x03, 0x03, 0x03, 0x03, 0x03,
+			0x0E, 0x03, 0x9C, 0x07, 0xF8, 0x3F, 0xF0, 0x3F, 0xFE, 0x1F, 0xFF, 0x3F,
+			0xE7, 0x39, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30, 0xE7, 0x39,
+			0x3E, 0x1F, 0x3C, 0x0F, 0xFC, 0x0F, 0xFE, 0x1F, 0x07, 0x38, 0x03, 0x30,
+			0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x07, 0x38, 0x0E, 0x1C, 0x0C, 0x0C,
+			0xFE, 0x1F, 0xFF, 0x3F, 0x07, 0x38, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30,
+			0x03, 0x30, 0x07, 0x38, 0xFE, 0x1F, 0xFC, 0x0F, 0xFE, 0x1F, 0xFF, 0x3F,
+			0xE7, 0x39, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30,
+			0x03, 0x30, 0x03, 0x30, 0xFE, 0x3F, 0xFF, 0x3F, 0xE7, 0x01, 0xC3, 0x00,
+			0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x03, 0x00, 0x03, 0x00,
+			0xFC, 0x0F, 0xFE, 0x1F, 0x07, 0x38, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30,
+			0x03, 0x33, 0x07, 0x33, 0x0F, 0x3F, 0x0E, 0x1E, 0xFF, 0x3F, 0xFF, 0x3F,
+			0xE0, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xE0, 0x01,
+			0xFF, 0x3F, 0xFF, 0x3F, 0x03, 0x30, 0x07, 0x38, 0xFF, 0x3F, 0xFF, 0x3F,
+			0x07, 0x38, 0x03, 0x30, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x30,
+			0x03, 0x30, 0x07, 0x38, 0xFF, 0x1F, 0xFF, 0x0F, 0x07, 0x00, 0x03, 0x00,
+			0xFF, 0x3F, 0xFF, 0x3F, 0xC0, 0x00, 0xC0, 0x00, 0x30, 0x03, 0x38, 0x07,
+			0x1C, 0x0E, 0x0E, 0x1C, 0x07, 0x38, 0x03, 0x30, 0xFF, 0x1F, 0xFF, 0x3F,
+			0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30,
+			0x00, 0x30, 0x00, 0x30, 0xFF, 0x3F, 0xFF, 0x3F, 0x0E, 0x00, 0x0C, 0x00,
+			0xF0, 0x03, 0xF0, 0x03, 0x0C, 0x00, 0x0E, 0x00, 0xFF, 0x3F, 0xFF, 0x3F,
+			0xFF, 0x3F, 0xFF, 0x3F, 0x38, 0x00, 0x30, 0x00, 0xE0, 0x00, 0xC0, 0x01,
+			0x00, 0x03, 0x00, 0x07, 0xFF, 0x3F, 0xFF, 0x3F, 0xFC, 0x0F, 0xFE, 0x1F,
+			0x07, 0x38, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x07, 0x38,
+			0xFE, 0x1F, 0xFC, 0x0F, 0xFE, 0x3F, 0xFF, 0x3F, 0xE7, 0x01, 0xC3, 0x00,
+			0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xE7, 0x00, 0x7E, 0x00, 0x3C, 0x00,
+			0xFC, 0x0F, 0xFE, 0x1F, 0x07, 0x38, 0x03, 0x30, 0x03, 0x33, 0x03, 0x33,
+			0x03, 0x0C, 0x07, 0x0C, 0xFE, 0x33, 0xFC, 0x33, 0xFE, 0x3F, 0xFF, 0x3F,
+			0xE7, 0x00, 0xC3, 0x00, 0xC3, 0x03, 0xC3, 0x07, 0xC3, 0x0C, 0xE7, 0x1C,
+			0x7E, 0x38, 0x3C, 0x30, 0x3C, 0x0C, 0x7E, 0x1C, 0xE7, 0x38, 0xC3, 0x30,
+			0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30, 0xC7, 0x39, 0x8E, 0x1F, 0x0C, 0x0F,
+			0x0E, 0x00, 0x0F, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x3F, 0xFF, 0x3F,
+			0x03, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0xFF, 0x0F, 0xFF, 0x1F,
+			0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38,
+			0xFF, 0x1F, 0xFF, 0x0F, 0xFF, 0x03, 0xFF, 0x07, 0x00, 0x0E, 0x00, 0x1C,
+			0x00, 0x30, 0x00, 0x30, 0x00, 0x1C, 0x00, 0x0E, 0xFF, 0x07, 0xFF, 0x03,
+			0xFF, 0x0F, 0xFF, 0x1F, 0x00, 0x30, 0x00, 0x30, 0xC0, 0x0F, 0xC0, 0x0F,
+			0x00, 0x30, 0x00, 0x30, 0xFF, 0x1F, 0xFF, 0x0F, 0x0F, 0x3C, 0x1F, 0x3E,
+			0x38, 0x07, 0x30, 0x03, 0xC0, 0x00, 0xC0, 0x00, 0x30, 0x03, 0x38, 0x07,
+			0x1F, 0x3E, 0x0F, 0x3C, 0x0F, 0x00, 0x1F, 0x00, 0x38, 0x00, 0x70, 0x00,
+			0xC0, 0x3F, 0xC0, 0x3F, 0x70, 0x00, 0x38, 0x00, 0x1F, 0x00, 0x0F, 0x00,
+			0x03, 0x1C, 0x03, 0x3E, 0x83, 0x33, 0xC3, 0x33, 0xC3, 0x31, 0xE3, 0x30,
+			0xF3, 0x30, 0x73, 0x30, 0x1F, 0x30, 0x0E, 0x30, 0xFE, 0x1F, 0xFF, 0x3F,
+			0x07, 0x38, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30,
+			0x0C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xC0, 0x01,
+			0x80, 0x03, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0C, 0x03, 0x30, 0x03, 0x30,
+			0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x07, 0x38, 0xFF, 0x3F, 0xFE, 0x1F,
+			0x30, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x03, 0x00, 0x03, 0x00,
+			0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x30,
+			0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30,
+			0x00, 0x30, 0x00, 0x30, 0x06, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x7E, 0x00,
+			0xE0, 0x00, 0xC0, 0x00, 0x00, 0x0C, 0x00, 0x1E, 0x30, 0x33, 0x30, 0x33,
+			0x30, 0x33, 0x30, 0x33, 0xE0, 0x3F, 0xC0, 0x3F, 0x00, 0x38, 0x00, 0x30,
+			0xFF, 0x3F, 0xFF, 0x3F, 0xC0, 0x0C, 0xC0, 0x0C, 0x70, 0x38, 0x30, 0x30,
+			0x30, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xC0, 0x0F, 0xC0, 0x0F, 0xE0, 0x1F,
+			0x70, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x70, 0x38,
+			0xE0, 0x1C, 0xC0, 0x0C, 0xC0, 0x0F, 0xE0, 0x1F, 0x70, 0x38, 0x30, 0x30,
+			0x30, 0x30, 0x70, 0x38, 0xC0, 0x0C, 0xC0, 0x0C, 0xFF, 0x3F, 0xFF, 0x3F,
+			0xC0, 0x0F, 0xE0, 0x1F, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33,
+			0x30, 0x33, 0x30, 0x33, 0xE0, 0x03, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x01,
+			0xFC, 0x3F, 0xFE, 0x3F, 0xE3, 0x01, 0xC3, 0x00, 0x0E, 0x00, 0x0C, 0x00,
+			0xC0, 0x03, 0xE0, 0x07, 0x70, 0xCE, 0x30, 0xCC, 0x30, 0xCC, 0x70, 0xCE,
+			0xF0, 0xC1, 0xE0, 0xE3, 0xE0, 0x7F, 0x80, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F,
+			0xC0, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00, 0x70, 0x00,
+			0xE0, 0x3F, 0xC0, 0x3F, 0x30, 0x30, 0x70, 0x38, 0xF3, 0x3F, 0xE3, 0x3F,
+			0x00, 0x38, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x30,
+			0x00, 0x30, 0x00, 0x38, 0xF3, 0x1F, 0xF3, 0x0F, 0xFF, 0x3F, 0xFF, 0x3F,
+			0x00, 0x03, 0x00, 0x03, 0xC0, 0x0C, 0xE0, 0x1C, 0x70, 0x38, 0x30, 0x30,
+			0x03, 0x30, 0x07, 0x38, 0xFF, 0x3F, 0xFE, 0x3F, 0x00, 0x38, 0x00, 0x30,
+			0xE0, 0x3F, 0xF0, 0x3F, 0x30, 0x00, 0x30, 0x00, 0xC0, 0x3F, 0xC0, 0x3F,
+			0x30, 0x00, 0x30, 0x00, 0xE0, 0x3F, 0xC0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F,
+			0xC0, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00, 0x70, 0x00,
+			0xE0, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xE0, 0x1F, 0x70, 0x38, 0x30, 0x30,
+			0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xC0, 0x0F,
+			0xF0, 0xFF, 0xF0, 0xFF, 0xC0, 0x03, 0x80, 0x01, 0x70, 0x0E, 0x30, 0x0C,
+			0x30, 0x0C, 0x70, 0x0E, 0xE0, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x07,
+			0x70, 0x0E, 0x30, 0x0C, 0x30, 0x0C, 0x70, 0x0E, 0x80, 0x01, 0xC0, 0x03,
+			0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x3F, 0xF0, 0x3F, 0xC0, 0x01, 0xC0, 0x00,
+			0x70, 0x00, 0x30, 0x00, 0x30, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xC0, 0x00,
+			0xC0, 0x30, 0xE0, 0x31, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33,
+			0x30, 0x33, 0x30, 0x33, 0x30, 0x1E, 0x30, 0x0C, 0x30, 0x00, 0x30, 0x00,
+			0x30, 0x00, 0x78, 0x00, 0xFF, 0x0F, 0xFF, 0x1F, 0x78, 0x30, 0x30, 0x30,
+			0x30, 0x1C, 0x30, 0x0C, 0xF0, 0x0F, 0xF0, 0x1F, 0x00, 0x38, 0x00, 0x30,
+			0x00, 0x30, 0x00, 0x38, 0x00, 0x0C, 0x00, 0x0E, 0xF0, 0x3F, 0xF0, 0x3F,
+			0xF0, 0x03, 0xF0, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x30, 0x00, 0x30,
+			0x00, 0x1C, 0x00, 0x0E, 0xF0, 0x07, 0xF0, 0x03, 0xF0, 0x0F, 0xF0, 0x1F,
+			0x00, 0x30, 0x00, 0x30, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x30, 0x00, 0x30,
+			0xF0, 0x1F, 0xF0, 0x0F, 0x30, 0x30, 0x70, 0x38, 0xE0, 0x1C, 0xC0, 0x0C,
+			0x00, 0x03, 0x00, 0x03, 0xC0, 0x0C, 0xE0, 0x1C, 0x70, 0x38, 0x30, 0x30,
+			0xF0, 0x30, 0xF0, 0x71, 0x80, 0xE3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3,
+			0x00, 0xC3, 0x80, 0xE7, 0xF0, 0x7F, 0xF0, 0x3F, 0x30, 0x30, 0x30, 0x38,
+			0x30, 0x3C, 0x30, 0x3E, 0x30, 0x33, 0x30, 0x33, 0xF0, 0x31, 0xF0, 0x30,
+			0x70, 0x30, 0x30, 0x30, 0xC0, 0x00, 0xE0, 0x01, 0x3C, 0x0F, 0x3E, 0x1F,
+			0x07, 0x38, 0x03, 0x30, 0x3F, 0x3F, 0x3F, 0x3F, 0x03, 0x30, 0x07, 0x38,
+			0x3E, 0x1F, 0x3C, 0x0F, 0xE0, 0x01, 0xC0, 0x00, 0x0C, 0x00, 0x0E, 0x00,
+			0x03, 0x00, 0x03, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x30, 0x00, 0x30, 0x00,
+			0x1C, 0x00, 0x0C, 0x00, 0xF3, 0x3F, 0xF3, 0x3F, 0xF0, 0x03, 0xF8, 0x07,
+			0x0C, 0x0C, 0x0E, 0x1C, 0xFF, 0x3F, 0xFF, 0x3F, 0x1E, 0x1E, 0x0C, 0x0C,
+			0xC0, 0x30, 0xE0, 0x39, 0xFC, 0x3F, 0xFE, 0x3F, 0xE7, 0x39, 0xC3, 0x30,
+			0x03, 0x30, 0x07, 0x38, 0x0E, 0x1C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1C, 0x0E,
+			0xE8, 0x05, 0xF0, 0x03, 0x30, 0x03, 0x30, 0x03, 0xF0, 0x03, 0xE8, 0x05,
+			0x1C, 0x0E, 0x0C, 0x0C, 0xC3, 0x0C, 0xC7, 0x0C, 0xCE, 0x0C, 0xCC, 0x1C,
+			0xF0, 0x3F, 0xF0, 0x3F, 0xCC, 0x1C, 0xCE, 0x0C, 0xC7, 0x0C, 0xC3, 0x0C,
+			0x3F, 0x3F, 0x3F, 0x3F, 0xCC, 0x00, 0xCE, 0x01, 0x33, 0x33, 0x33, 0x33,
+			0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE0, 0x1C, 0xC0, 0x0C,
+			0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00,
+			0xFC, 0x0F, 0xFE, 0x1F, 0xC7, 0x38, 0xC3, 0x30, 0x33, 0x33, 0x33, 0x33,
+			0x33, 0x33, 0x33, 0x33, 0xFE, 0x1F, 0xFC, 0x0F, 0xE3, 0x31, 0xF3, 0x33,
+			0x33, 0x33, 0x33, 0x33, 0xFF, 0x33, 0xFE, 0x31, 0xC0, 0x00, 0xE0, 0x01,
+			0x30, 0x03, 0x38, 0x07, 0xCC, 0x0C, 0xCC, 0x0C, 0x30, 0x03, 0x30, 0x03,
+			0x1C, 0x0E, 0x0C, 0x0C, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+			0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x70, 0x00, 0xF0, 0x03, 0xE0, 0x03,
+			0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+			0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFC, 0x0F, 0xFE, 0x1F,
+			0xF3, 0x33, 0xF3, 0x31, 0xF3, 0x30, 0x63, 0x30, 0x03, 0x33, 0x07, 0x33,
+			0xFE, 0x1F, 0xFC, 0x0F, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+			0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+			0x3C, 0x00, 0x7E, 0x00, 0xE7, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xE7, 0x00,
+			0x7E, 0x00, 0x3C, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x78, 0x30,
+			0xFF, 0x33, 0xFF, 0x33, 0x78, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+			0xC3, 0x00, 0xE3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xCE, 0x00, 0xCC, 0x00,
+			0x03, 0x03, 0x03, 0x03, 0x33, 0x03, 0x33, 0x03, 0xCE, 0x01, 0xCC, 0x00,
+			0x0C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x00, 0xF0, 0xFF, 0xF0, 0xFF,
+			0x00, 0x1E, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0E, 0xF0, 0x03, 0xF0, 0x03,
+			0x00, 0x0E, 0x00, 0x0C, 0x18, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0xFF, 0x01,
+			0xFF, 0x3F, 0xFF, 0x3F, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x3F, 0xFE, 0x3F,
+			0xC0, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x70,
+			0x0C, 0x03, 0x9E, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0x80, 0x03, 0x00, 0x03,
+			0x7E, 0x0C, 0xFF, 0x0C, 0xC3, 0x0C, 0xC3, 0x0C, 0xFF, 0x0C, 0x7E, 0x0C,
+			0x0C, 0x0C, 0x1C, 0x0E, 0x30, 0x03, 0x30, 0x03, 0xCC, 0x0C, 0xCC, 0x0C,
+			0x38, 0x07, 0x30, 0x03, 0xE0, 0x01, 0xC0, 0x00, 0x3F, 0x0C, 0x3F, 0x0E,
+			0x00, 0x03, 0x80, 0x03, 0xF0, 0x18, 0xF8, 0x7C, 0x9C, 0xFF, 0x0C, 0xFF,
+			0x00, 0x78, 0x00, 0x30, 0x3F, 0x0C, 0x3F, 0x0E, 0x00, 0x07, 0x80, 0x03,
+			0xF0, 0xC0, 0xF8, 0xE0, 0x9C, 0xF3, 0x0C, 0xF3, 0x00, 0xCF, 0x00, 0xCE,
+			0x33, 0x0C, 0x33, 0x0E, 0x3F, 0x03, 0x1E, 0x03, 0xE0, 0x18, 0xC0, 0x7C,
+			0x8C, 0xFF, 0x0C, 0xFF, 0x00, 0x78, 0x00, 0x30, 0x00, 0x0F, 0x80, 0x1F,
+			0xC0, 0x39, 0xE0, 0x30, 0x73, 0x30, 0x33, 0x30, 0x00, 0x30, 0x00, 0x38,
+			0x00, 0x1C, 0x00, 0x0C, 0x00, 0x3F, 0x80, 0x3F, 0xC3, 0x1C, 0xE7, 0x0C,
+			0x3E, 0x0C, 0x3C, 0x0C, 0xE0, 0x0C, 0xC0, 0x1C, 0x80, 0x3F, 0x00, 0x3F,
+			0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x1C, 0xE0, 0x0C, 0x3C, 0x0C, 0x3E, 0x0C,
+			0xE7, 0x0C, 0xC3, 0x1C, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x3F,
+			0xCC, 0x1C, 0xCE, 0x0C, 0x33, 0x0C, 0x33, 0x0C, 0xCE, 0x0C, 0xCC, 0x1C,
+			0x80, 0x3F, 0x00, 0x3F, 0x0C, 0x3F, 0x8E, 0x3F, 0xC7, 0x1C, 0xE3, 0x0C,
+			0x33, 0x0C, 0x33, 0x0C, 0xCC, 0x0C, 0xCC, 0x1C, 0x87, 0x3F, 0x03, 0x3F,
+			0x00, 0x3F, 0x80, 0x3F, 0xC3, 0x1C, 0xE3, 0x0C, 0x30, 0x0C, 0x30, 0x0C,
+			0xE3, 0x0C, 0xC3, 0x1C, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x3F,
+			0xCE, 0x1C, 0xCF, 0x0C, 0x33, 0x0C, 0x33, 0x0C, 0xCF, 0x0C, 0xCE, 0x1C,
+			0x80, 0x3F, 0x00, 0x3F, 0xFC, 0x3F, 0xFE, 0x3F, 0xC3, 0x00, 0xC3, 0x00,
+			0xFF, 0x1F, 0xFF, 0x3F, 0xE7, 0x39, 0xC3, 0x30, 0x03, 0x30, 0x03, 0x30,
+			0xC0, 0x0F, 0xE0, 0x1F, 0x70, 0x38, 0x30, 0x70, 0x30, 0x70, 0x30, 0xF0,
+			0x30, 0xF0, 0x70, 0x68, 0xE0, 0x1C, 0xC0, 0x0C, 0xE0, 0x1F, 0xF0, 0x3F,
+			0x33, 0x33, 0x33, 0x33, 0x3E, 0x33, 0x3C, 0x33, 0x38, 0x33, 0x30, 0x33,
+			0x30, 0x30, 0x30, 0x30, 0xE0, 0x1F, 0xF0, 0x3F, 0x30, 0x33, 0x38, 0x33,
+			0x3C, 0x33, 0x3E, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30,
+			0xE0, 0x1F, 0xF8, 0x3F, 0x3C, 0x33, 0x3E, 0x33, 0x33, 0x33, 0x33, 0x33,
+			0x3E, 0x33, 0x3C, 0x33, 0x38, 0x30, 0x30, 0x30, 0xE0, 0x1F, 0xF0, 0x3F,
+			0x33, 0x33, 0x33, 0x33, 0x30, 0x33, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33,
+			0x30, 0x30, 0x30, 0x30, 0x33, 0x30, 0x73, 0x38, 0xFE, 0x3F, 0xFC, 0x3F,
+			0x78, 0x38, 0x30, 0x30, 0x30, 0x30, 0x78, 0x38, 0xFC, 0x3F, 0xFE, 0x3F,
+			0x73, 0x38, 0x33, 0x30, 0x1C, 0x30, 0x7E, 0x38, 0xF3, 0x3F, 0xF3, 0x3F,
+			0x7E, 0x38, 0x1C, 0x30, 0x33, 0x30, 0x73, 0x38, 0xF0, 0x3F, 0xF0, 0x3F,
+			0x73, 0x38, 0x33, 0x30, 0xFE, 0x1F, 0xFF, 0x3F, 0xE7, 0x39, 0xC3, 0x30,
+			0xC3, 0x30, 0xC3, 0x30, 0x03, 0x30, 0x07, 0x38, 0xFE, 0x1F, 0xFC, 0x0F,
+			0xFC, 0x3F, 0xFE, 0x3F, 0xE7, 0x00, 0xC3, 0x00, 0x83, 0x03, 0x07, 0x07,
+			0x0C, 0x0C, 0x1C, 0x1C, 0xF3, 0x3F, 0xF3, 0x3F, 0xC0, 0x0F, 0xE0, 0x1F,
+			0x73, 0x38, 0x33, 0x30, 0x3E, 0x30, 0x3C, 0x30, 0x38, 0x30, 0x70, 0x38,
+			0xE0, 0x1F, 0xC0, 0x0F, 0xC0, 0x0F, 0xE0, 0x1F, 0x70, 0x38, 0x38, 0x30,
+			0x3C, 0x30, 0x3E, 0x30, 0x33, 0x30, 0x73, 0x38, 0xE0, 0x1F, 0xC0, 0x0F,
+			0xC0, 0x0F, 0xE0, 0x1F, 0x5C, 0x38, 0x3E, 0x30, 0x33, 0x30, 0x33, 0x30,
+			0x3E, 0x30, 0x5C, 0x38, 0xE0, 0x1F, 0xC0, 0x0F, 0xCC, 0x0F, 0xCE, 0x1F,
+			0x73, 0x38, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x3C, 0x30, 0x5C, 0x38,
+			0xE7, 0x1F, 0xC3, 0x0F, 0xC0, 0x0F, 0xE0, 0x1F, 0x73, 0x38, 0x33, 0x30,
+			0x30, 0x30, 0x30, 0x30, 0x33, 0x30, 0x73, 0x38, 0xE0, 0x1F, 0xC0, 0x0F,
+			0x0C, 0x0C, 0x1C, 0x0E, 0x38, 0x07, 0x30, 0x03, 0xC0, 0x00, 0xC0, 0x00,
+			0x30, 0x03, 0x38, 0x07, 0x1C, 0x0E, 0x0C, 0x0C, 0xFC, 0x07, 0xFE, 0x1F,
+			0x07, 0x1C, 0x03, 0x38, 0xF3, 0x33, 0xF3, 0x33, 0x07, 0x30, 0x0E, 0x38,
+			0xFE, 0x1F, 0xF8, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0x03, 0x38, 0x07, 0x30,
+			0x0E, 0x30, 0x0C, 0x30, 0x00, 0x30, 0x00, 0x38, 0xF0, 0x1F, 0xF0, 0x0F,
+			0xF0, 0x0F, 0xF0, 0x1F, 0x00, 0x38, 0x00, 0x30, 0x0C, 0x30, 0x0E, 0x30,
+			0x07, 0x30, 0x03, 0x38, 0xF0, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x1F,
+			0x1C, 0x38, 0x0E, 0x30, 0x03, 0x30, 0x03, 0x30, 0x0E, 0x30, 0x1C, 0x38,
+			0xF8, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0x03, 0x38, 0x03, 0x30,
+			0x00, 0x30, 0x00, 0x30, 0x03, 0x30, 0x03, 0x38, 0xF0, 0x1F, 0xF0, 0x0F,
+			0xF0, 0x00, 0xF0, 0x01, 0x80, 0x03, 0x00, 0x07, 0x0C, 0x3C, 0x0E, 0x3C,
+			0x07, 0x07, 0x83, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0xFF, 0x3F, 0xFF, 0x3F,
+			0x9E, 0x07, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x9C, 0x03,
+			0xF8, 0x01, 0xF0, 0x00, 0xFC, 0x3F, 0xFE, 0x3F, 0x07, 0x00, 0x03, 0x00,
+			0xC3, 0x30, 0xE7, 0x39, 0x3E, 0x1F, 0x3C, 0x0F, 0x00, 0x0C, 0x00, 0x1E,
+			0x33, 0x33, 0x33, 0x33, 0x3E, 0x33, 0x1C, 0x33, 0xE0, 0x3F, 0xC0, 0x3F,
+			0x00, 0x38, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x1E, 0x30, 0x33, 0x38, 0x33,
+			0x3C, 0x33, 0x1E, 0x33, 0xE7, 0x3F, 0xC3, 0x3F, 0x00, 0x38, 0x00, 0x30,
+			0x00, 0x0C, 0x00, 0x1E, 0x1C, 0x33, 0x3E, 0x33, 0x33, 0x33, 0x33, 0x33,
+			0xCE, 0x3F, 0xCC, 0x3F, 0x00, 0x38, 0x00, 0x30, 0x0C, 0x0C, 0x1E, 0x1E,
+			0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xCC, 0x3F, 0xCC, 0x3F,
+			0x07, 0x38, 0x03, 0x30, 0x00, 0x0C, 0x00, 0x1E, 0x33, 0x33, 0x33, 0x33,
+			0x30, 0x33, 0x30, 0x33, 0xE3, 0x3F, 0xC3, 0x3F, 0x00, 0x38, 0x00, 0x30,
+			0x00, 0x0C, 0x00, 0x1E, 0x1E, 0x33, 0x3F, 0x33, 0x33, 0x33, 0x33, 0x33,
+			0xCF, 0x3F, 0xCE, 0x3F, 0x00, 0x38, 0x00, 0x30, 0x30, 0x0C, 0x30, 0x1E,
+			0x30, 0x33, 0x30, 0x33, 0xC0, 0x3F, 0xC0, 0x3F, 0x30, 0x33, 0x30, 0x33,
+			0xE0, 0x33, 0xC0, 0x31, 0xC0, 0x0F, 0xE0, 0x1F, 0x70, 0x38, 0x30, 0x70,
+			0x30, 0x70, 0x30, 0xF0, 0x30, 0xF0, 0x70, 0x68, 0xE0, 0x1C, 0xC0, 0x0C,
+			0xC0, 0x0F, 0xE0, 0x1F, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x33, 0x3C, 0x33,
+			0x38, 0x33, 0x30, 0x33, 0xE0, 0x03, 0xC0, 0x01, 0xC0, 0x0F, 0xE0, 0x1F,
+			0x30, 0x33, 0x38, 0x33, 0x3C, 0x33, 0x3E, 0x33, 0x33, 0x33, 0x33, 0x33,
+			0xE0, 0x03, 0xC0, 0x01, 0xC0, 0x0F, 0xE0, 0x1F, 0x1C, 0x33, 0x3E, 0x33,
+			0x33, 0x33, 0x33, 0x33, 0x3E, 0x33, 0x1C, 0x33, 0xE0, 0x03, 0xC0, 0x01,
+			0xC0, 0x0F, 0xE0, 0x1F, 0x33, 0x33, 0x33, 0x33, 0x30, 0x33, 0x30, 0x33,
+			0x33, 0x33, 0x33, 0x33, 0xE0, 0x03, 0xC0, 0x01, 0x33, 0x30, 0x73, 0x38,
+			0xFE, 0x3F, 0xFC, 0x3F, 0x00, 0x38, 0x00, 0x30, 0x30, 0x30, 0x78, 0x38,
+			0xFC, 0x3F, 0xFE, 0x3F, 0x07, 0x38, 0x03, 0x30, 0x1C, 0x30, 0x7E, 0x38,
+			0xF3, 0x3F, 0xE3, 0x3F, 0x1E, 0x38, 0x0C, 0x30, 0x33, 0x30, 0x73, 0x38,
+			0xF0, 0x3F, 0xE0, 0x3F, 0x03, 0x38, 0x03, 0x30, 0x33, 0x0F, 0x33, 0x1F,
+			0xCC, 0x39, 0xCC, 0x30, 0xF3, 0x30, 0xF3, 0x30, 0xE0, 0x30, 0xC0, 0x39,
+			0x80, 0x1F, 0x00, 0x0F, 0xFC, 0x3F, 0xFE, 0x3F, 0xC7, 0x01, 0xC3, 0x00,
+			0x73, 0x00, 0x33, 0x00, 0x3C, 0x00, 0x5C, 0x00, 0xE7, 0x3F, 0xC3, 0x3F,
+			0xC0, 0x0F, 0xE0, 0x1F, 0x73, 0x38, 0x33, 0x30, 0x3E, 0x30, 0x3C, 0x30,
+			0x38, 0x30, 0x70, 0x38, 0xE0, 0x1F, 0xC0, 0x0F, 0xC0, 0x0F, 0xE0, 0x1F,
+			0x70, 0x38, 0x38, 0x30, 0x3C, 0x30, 0x3E, 0x30, 0x33, 0x30, 0x73, 0x38,
+			0xE0, 0x1F, 0xC0, 0x0F, 0xC0, 0x0F, 0xE0, 0x1F, 0x5C, 0x38, 0x3E, 0x30,
+			0x33, 0x30, 0x33, 0x30, 0x3E, 0x30, 0x5C, 0x38, 0xE0, 0x1F, 0xC0, 0x0F,
+			0xCC, 0x0F, 0xCE, 0x1F, 0x73, 0x38, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30,
+			0x3C, 0x30, 0x5C, 0x38, 0xE7, 0x1F, 0xC3, 0x0F, 0xC0, 0x0F, 0xE0, 0x1F,
+			0x73, 0x38, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x30, 0x73, 0x38,
+			0xE0, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+			0xCC, 0x0C, 0xCC, 0x0C, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+			0xC0, 0x1F, 0xE0, 0x3F, 0x70, 0x3C, 0x30, 0x38, 0x30, 0x33, 0x30, 0x33,
+			0x70, 0x30, 0xF0, 0x38, 0xF0, 0x1F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F,
+			0x03, 0x38, 0x07, 0x30, 0x0E, 0x30, 0x0C, 0x38, 0x00, 0x0C, 0x00, 0x0E,
+			0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x0F, 0xF0, 0x1F, 0x00, 0x38, 0x00, 0x30,
+			0x0C, 0x30, 0x0E, 0x38, 0x07, 0x0C, 0x03, 0x0E, 0xF0, 0x3F, 0xF0, 0x3F,
+			0xF0, 0x0F, 0xF8, 0x1F, 0x1C, 0x38, 0x0E, 0x30, 0x03, 0x30, 0x03, 0x38,
+			0x0E, 0x0C, 0x1C, 0x0E, 0xF8, 0x3F, 0xF0, 0x3F, 0xF0, 0x0F, 0xF0, 0x1F,
+			0x03, 0x38, 0x03, 0x30, 0x00, 0x30, 0x00, 0x38, 0x03, 0x0C, 0x03, 0x0E,
+			0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x30, 0xF0, 0x71, 0x80, 0xE3, 0x00, 0xC3,
+			0x0C, 0xC3, 0x0E, 0xC3, 0x07, 0xC3, 0x83, 0xE7, 0xF0, 0x7F, 0xF0, 0x3F,
+			0xFF, 0x3F, 0xFF, 0x3F, 0x38, 0x07, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03,
+			0x30, 0x03, 0x30, 0x03, 0xE0, 0x01, 0xC0, 0x00, 0xF0, 0x30, 0xF0, 0x71,
+			0x83, 0xE3, 0x03, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x03, 0xC3, 0x83, 0xE7,
+			0xF0, 0x7F, 0xF0, 0x3F, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+			0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+			0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+			0xC0, 0x00, 0xC0, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x07, 0x00, 0x03, 0x00,
+			0x30, 0x00, 0x38, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x3E, 0x00,
+			0x03, 0x00, 0x03, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x07, 0x00, 0x03, 0x00,
+			0x30, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x30, 0x00, 0x30, 0x00,
+			0x1F, 0x00, 0x0F, 0x00, 0xE0, 0x01, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03,
+			0xF0, 0x03, 0xE0, 0x01, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30,
+			0x30, 0x03, 0x38, 0x07, 0xFC, 0x0F, 0xFE, 0x1F, 0x33, 0x33, 0x33, 0x33,
+			0x33, 0x33, 0x33, 0x33, 0x03, 0x30, 0x03, 0x30, 0xC0, 0x00, 0xE0, 0x01,
+			0xF0, 0x03, 0xF8, 0x07, 0xCC, 0x0C, 0xCC, 0x0C, 0xC0, 0x00, 0xC0, 0x00,
+			0xC0, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x38, 0x00, 0x0C, 0x00, 0x0E, 0x00,
+			0xFF, 0x3F, 0xFF, 0x3F, 0x0E, 0x00, 0x0C, 0x00, 0x38, 0x00, 0x30, 0x00,
+			0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xCC, 0x0C, 0xCC, 0x0C,
+			0xF8, 0x07, 0xF0, 0x03, 0xE0, 0x01, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x07,
+			0x00, 0x0C, 0x00, 0x1C, 0xFF, 0x3F, 0xFF, 0x3F, 0x00, 0x1C, 0x00, 0x0C,
+			0x00, 0x07, 0x00, 0x03, 0xC0, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x07,
+			0x00, 0x0F, 0x80, 0x0E, 0xF0, 0x01, 0xF8, 0x00, 0x1C, 0x00, 0x0C, 0x00,
+			0x0C, 0x0C, 0x1C, 0x0E, 0x38, 0x07, 0x30, 0x03, 0xC0, 0x00, 0xC0, 0x00,
+			0x30, 0x03, 0x38, 0x07, 0x1C, 0x0E, 0x0C, 0x0C,
+};
+
+const ssd1306_font_t ssd1306_font_prop16 =
+{
+			16, 2, 32, 126, ssd1306_font_prop16_glyphs, ssd1306_font_prop16_bitmap, &ssd1306_charmap_latin1
+};
+
+#endif
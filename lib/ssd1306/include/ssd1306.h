@@ -33,6 +33,49 @@ SOFTWARE.
 #include <pico/stdlib.h>
 #include <hardware/i2c.h>
 
+/**
+*	@brief placement of the hot path (drawing, glyph rendering and flush)
+*
+*	With HOT_PATH_IN_SRAM the drawing primitives and the flush path are linked
+*	into SRAM and the builtin font is placed in .data (copied to RAM at boot),
+*	so per-pixel loops don't stall on XIP cache misses.
+*/
+#if HOT_PATH_IN_SRAM
+#define SSD1306_HOT(func) __not_in_flash_func(func)
+#define SSD1306_FONT_ATTR __not_in_flash("ssd1306_font")
+#else
+#define SSD1306_HOT(func) func
+#define SSD1306_FONT_ATTR
+#endif
+
+/**
+*	@brief largest text scale rendered through the bit-expansion tables
+*
+*	Up to this scale each font column byte is expanded by a single table
+*	lookup and written as whole page bytes; larger scales fall back to
+*	drawing one square per font pixel.
+*/
+#define SSD1306_LUT_MAX_SCALE 4
+
+/**
+*	@brief deadline of one i2c write: base plus a time per byte
+*
+*	A byte takes 22.5 us at 400 kHz; the per byte time leaves room for clock
+*	stretching and slower bus clocks.
+*/
+#define SSD1306_TIMEOUT_BASE_US 500
+#define SSD1306_TIMEOUT_BYTE_US 50
+
+/**
+*	@brief attempts made after a NACK or timeout before a write is given up
+*/
+#define SSD1306_WRITE_RETRIES 2
+
+/**
+*	@brief upper bound of ssd1306_bus_recover (9 SCL pulses, STOP, re-init)
+*/
+#define SSD1306_RECOVERY_US 200
+
 /**
 *	@brief defines commands used in ssd1306
 */
@@ -53,9 +96,70 @@ typedef enum {
     SET_DISP_CLK_DIV = 0xD5,
     SET_PRECHARGE = 0xD9,
     SET_VCOM_DESEL = 0xDB,
-    SET_CHARGE_PUMP = 0x8D
+    SET_CHARGE_PUMP = 0x8D,
+    SET_IREF_DCDC = 0xAD,		/* SSD1306: Iref select, SH1106: DC-DC control */
+    SET_PAGE_START = 0xB0,		/* page addressing: page in the low 3 bits */
+    SET_COL_LOW = 0x00,			/* page addressing: low nibble of the column */
+    SET_COL_HIGH = 0x10			/* page addressing: high nibble of the column */
 } ssd1306_command_t;
 
+/**
+*	@brief display controllers handled by the driver
+*/
+typedef enum {
+    SSD1306_CTRL_SSD1306,	/**< 128 columns, horizontal addressing, charge pump */
+    SSD1306_CTRL_SH1106,	/**< 132 columns, page addressing only, DC-DC converter */
+    SSD1306_CTRL_SSD1309	/**< SSD1306 command set, external VCC, no charge pump */
+} ssd1306_controller_t;
+
+/**
+*	@brief controller and glass of a panel
+*
+*	Picks the init sequence and the flush: controllers with horizontal
+*	addressing get one window command and one data write per frame (or per
+*	area), page addressed controllers one page command and one data write per
+*	page. col_offset is where the glass starts in the column RAM; the glass
+*	is centered in it, so the 180 degree remap keeps the same offset.
+*/
+typedef struct {
+    uint8_t controller;		/**< ssd1306_controller_t */
+    uint8_t width;			/**< visible columns */
+    uint8_t height;			/**< visible rows, multiple of 8 */
+    uint8_t col_offset;		/**< RAM column of the leftmost visible column */
+    uint8_t com_pins;		/**< SET_COM_PIN_CFG argument: 0x02 sequential, 0x12 alternative */
+    uint8_t iref;			/**< SSD1306 SET_IREF_DCDC argument (0x30: internal Iref), 0: not sent */
+} ssd1306_profile_t;
+
+extern const ssd1306_profile_t ssd1306_profile_128x64;	/**< SSD1306, 0.96" */
+extern const ssd1306_profile_t ssd1306_profile_128x32;	/**< SSD1306, 0.91" */
+extern const ssd1306_profile_t ssd1306_profile_72x40;	/**< SSD1306, 0.42" */
+extern const ssd1306_profile_t sh1106_profile_128x64;	/**< SH1106, 1.3" */
+extern const ssd1306_profile_t ssd1309_profile_128x64;	/**< SSD1309, 1.54"/2.42" */
+
+/**
+*	@brief mounting rotation of the panel, clockwise
+*
+*	0 and 180 are done by the controller's segment/COM remap. 90 and 270 swap
+*	the logical width and height; the buffer stays in page format for the
+*	rotated geometry and is transposed in 8x8 blocks by ssd1306_show.
+*/
+typedef enum {
+    SSD1306_ROTATE_0,
+    SSD1306_ROTATE_90,
+    SSD1306_ROTATE_180,
+    SSD1306_ROTATE_270
+} ssd1306_rotation_t;
+
+/**
+*	@brief replacement for the driver's own i2c write
+*
+*	Gets every write of the display (control byte included) and returns
+*	what i2c_write_timeout_us() would: len on success, PICO_ERROR_GENERIC
+*	for a NACK, PICO_ERROR_TIMEOUT for a missed deadline. The driver keeps
+*	its retries but leaves the bus recovery to the transport.
+*/
+typedef int (*ssd1306_transport_t)(void *ctx, uint8_t address, const uint8_t *src, size_t len);
+
 /**
 *	@brief holds the configuration
 */
@@ -68,8 +172,123 @@ typedef struct {
     bool external_vcc; 	/**< whether display uses external vcc */ 
     uint8_t *buffer;	/**< display buffer */
     size_t bufsize;		/**< buffer size */
+    uint8_t rotation;	/**< ssd1306_rotation_t, set with ssd1306_set_rotation */
+    uint8_t buf_page;	/**< first page held in the buffer (moves in strip mode) */
+    uint8_t buf_pages;	/**< pages held in the buffer: pages, or 1 in strip mode */
+    ssd1306_profile_t profile;	/**< controller and glass, set on initialization */
+    ssd1306_transport_t transport;	/**< NULL: the driver writes to i2c_i itself */
+    void *transport_ctx;	/**< passed to transport */
 } ssd1306_t;
 
+/**
+*	@brief frame drawing callback for ssd1306_render
+*
+*	Draws the whole frame with the usual drawing functions; in strip mode it
+*	is called once per page and everything outside that page is clipped.
+*/
+typedef void (*ssd1306_draw_cb_t)(ssd1306_t *p, void *ctx);
+
+/**
+*	@brief i2c error accounting of the driver, shared by all displays
+*/
+typedef struct {
+    uint32_t writes;		/**< write attempts */
+    uint32_t nacks;			/**< attempts not acknowledged */
+    uint32_t timeouts;		/**< attempts that missed their deadline */
+    uint32_t retries;		/**< attempts repeated after a NACK or timeout */
+    uint32_t recoveries;	/**< bus recoveries */
+    uint32_t failures;		/**< writes given up after all retries */
+} ssd1306_bus_stats_t;
+
+extern ssd1306_bus_stats_t ssd1306_bus_stats;	/**< counters only grow */
+
+/**
+*	@brief code point to extended glyph map
+*
+*	Two-level table: rows[cp/32] is the block describing code points
+*	cp&~31 .. cp|31 (0: none), and each 32 entry block holds the extended
+*	glyph number + 1 (0: no glyph). A lookup is two array reads.
+*/
+typedef struct {
+    uint16_t limit;			/**< code points >= limit have no glyph */
+    uint8_t count;			/**< number of extended glyphs */
+    const uint8_t *rows;	/**< first level, limit/32 entries */
+    const uint8_t *blocks;	/**< second level, 32 entries per block */
+} ssd1306_charmap_t;
+
+/**
+*	@brief glyph of a proportional font
+*/
+typedef struct {
+    uint16_t offset;	/**< first column of the glyph in the font bitmap (in columns) */
+    uint8_t width;		/**< columns stored in the bitmap */
+    uint8_t advance;	/**< horizontal advance, spacing included */
+} ssd1306_glyph_t;
+
+/**
+*	@brief proportional font with glyphs taller than one page
+*
+*	Columns are stored top to bottom, <pages> bytes per column, bit 0 on top.
+*/
+typedef struct {
+    uint8_t height;		/**< glyph height in pixels */
+    uint8_t pages;		/**< bytes per column, (height+7)/8 */
+    uint8_t first;		/**< first character in the font */
+    uint8_t last;		/**< last character in the font */
+    const ssd1306_glyph_t *glyphs;	/**< last-first+1 glyphs */
+    const uint8_t *bitmap;	/**< column data of all glyphs */
+    const ssd1306_charmap_t *map;	/**< extended glyphs after the ASCII ones, or NULL */
+} ssd1306_font_t;
+
+/**
+*	@brief horizontal anchor for ssd1306_draw_text_aligned
+*/
+typedef enum {
+    SSD1306_ALIGN_LEFT,		/**< x is the left edge */
+    SSD1306_ALIGN_CENTER,	/**< x is the center */
+    SSD1306_ALIGN_RIGHT		/**< x is the right edge (exclusive) */
+} ssd1306_align_t;
+
+/**
+*	@brief entries of the string width cache used by ssd1306_text_width_cached
+*/
+#define SSD1306_TEXT_CACHE_SIZE 8
+
+/**
+*	@brief longest string (bytes) kept by the width cache; longer ones are measured every time
+*/
+#define SSD1306_TEXT_CACHE_LEN 24
+
+/**
+*	@brief most vertices of a polygon given to ssd1306_fill_polygon
+*/
+#define SSD1306_POLY_MAX_POINTS 16
+
+/**
+*	@brief vertex of a polygon
+*
+*	Vertices sit on pixel corners: the square (0,0) (4,0) (4,4) (0,4)
+*	covers the 4x4 pixels 0..3.
+*/
+typedef struct {
+    int16_t x;
+    int16_t y;
+} ssd1306_point_t;
+
+/**
+*	@brief rectangle limiting a fill, same convention as ssd1306_draw_square
+*/
+typedef struct {
+    int16_t x;			/**< first column */
+    int16_t y;			/**< first row */
+    uint16_t width;		/**< columns */
+    uint16_t height;	/**< rows */
+} ssd1306_rect_t;
+
+extern const ssd1306_charmap_t ssd1306_charmap_latin1;	/**< Latin-1 and a few symbols */
+extern const ssd1306_font_t ssd1306_font_prop8;		/**< 8 px proportional font */
+extern const ssd1306_font_t ssd1306_font_prop16;	/**< 16 px proportional font */
+
 /**
 *	@brief initialize display
 *
@@ -85,6 +304,123 @@ typedef struct {
 */
 bool ssd1306_init(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, i2c_inst_t *i2c_instance);
 
+/**
+*	@brief initialize display for a given controller and glass
+*
+*	ssd1306_init and ssd1306_init_strip pick an SSD1306 profile from the
+*	geometry; other controllers need this call.
+*
+*	@param[in] p : pointer to instance of ssd1306_t
+*	@param[in] profile : controller and geometry of the panel
+*	@param[in] address : i2c address of display
+*	@param[in] i2c_instance : instance of i2c connection
+*	@param[in] strip : one page buffer, as ssd1306_init_strip
+*
+* 	@return bool.
+*	@retval true for Success
+*	@retval false if initialization failed
+*/
+bool ssd1306_init_profile(ssd1306_t *p, const ssd1306_profile_t *profile, uint8_t address, i2c_inst_t *i2c_instance, bool strip);
+
+/**
+*	@brief initialize display in strip mode
+*
+*	Like ssd1306_init, but the buffer holds a single page (width bytes)
+*	instead of the whole frame. Frames are drawn with ssd1306_render, which
+*	runs the draw callback once per page and sends each page as soon as it
+*	is complete: CPU time for drawing grows by the number of pages, RAM for
+*	the buffer shrinks by the same factor. 90/270 rotation is not available.
+*
+*	@param[in] p : pointer to instance of ssd1306_t
+*	@param[in] width : width of display
+*	@param[in] height : heigth of display
+*	@param[in] address : i2c address of display
+*	@param[in] i2c_instance : instance of i2c connection
+*
+* 	@return bool.
+*	@retval true for Success
+*	@retval false if initialization failed
+*/
+bool ssd1306_init_strip(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, i2c_inst_t *i2c_instance);
+
+/**
+*	@brief hook called after every i2c write issued by the driver
+*
+*	The library provides an empty weak definition; applications override it
+*	to collect bus statistics. It runs in the caller's context after every
+*	attempt, retries included.
+*
+*	The DMA flush (ssd1306_dma.h) calls it once per display and frame, with
+*	the bytes of the whole frame.
+*
+*	@param[in] len : bytes written (including the control bytes)
+*	@param[in] result : len on success, PICO_ERROR_GENERIC on a NACK or
+*	PICO_ERROR_TIMEOUT past the deadline, whether the write went through
+*	i2c_write_timeout_us(), a transport or the DMA flush
+*	@param[in] elapsed_us : duration of the write
+*/
+void ssd1306_i2c_hook(size_t len, int result, uint32_t elapsed_us);
+
+/**
+*	@brief register the pins and clock of an i2c controller
+*
+*	Needed by ssd1306_bus_recover to clock a stuck bus free; without it a
+*	recovery only resets the controller at 400 kHz.
+*
+*	@param[in] i2c : i2c controller
+*	@param[in] sda : SDA pin
+*	@param[in] scl : SCL pin
+*	@param[in] baudrate : clock passed to i2c_init
+*/
+void ssd1306_bus_config(i2c_inst_t *i2c, uint sda, uint scl, uint baudrate);
+
+/**
+*	@brief free a stuck bus and re-initialize the controller
+*
+*	Clocks SCL until the target releases SDA (at most 9 pulses), issues a
+*	STOP and re-initializes the controller. Called by the driver after a
+*	write timeout; takes less than SSD1306_RECOVERY_US.
+*
+*	@param[in] i2c : i2c controller
+*/
+void ssd1306_bus_recover(i2c_inst_t *i2c);
+
+/**
+*	@brief route the writes of a display through another transport
+*
+*	For a bus shared with other devices: the transport can queue and
+*	interleave the writes with other traffic. Data writes (control byte
+*	0x40) may be split anywhere, since the controller keeps its address
+*	pointer between transactions.
+*
+*	@param[in] p : instance of display
+*	@param[in] transport : write function, or NULL to write directly again
+*	@param[in] ctx : passed to transport
+*/
+void ssd1306_set_transport(ssd1306_t *p, ssd1306_transport_t transport, void *ctx);
+
+/**
+*	@brief deadline of a single i2c write of len bytes
+*
+*	@param[in] len : bytes written, control byte included
+*
+*	@return SSD1306_TIMEOUT_BASE_US + len * SSD1306_TIMEOUT_BYTE_US
+*/
+uint32_t ssd1306_write_timeout_us(size_t len);
+
+/**
+*	@brief worst case time to send a whole frame
+*
+*	Every write of ssd1306_show (or of ssd1306_render in strip mode) timing
+*	out on every attempt, with a recovery between attempts. Drawing time is
+*	not included.
+*
+*	@param[in] p : instance of display
+*
+*	@return bound in microseconds
+*/
+uint32_t ssd1306_show_bound_us(const ssd1306_t *p);
+
 /**
 *	@brief deinitialize display
 *
@@ -127,14 +463,86 @@ void ssd1306_contrast(ssd1306_t *p, uint8_t val);
 */
 void ssd1306_invert(ssd1306_t *p, uint8_t inv);
 
+/**
+	@brief set the mounting rotation
+
+	width, height and pages of p become the logical (rotated) geometry and
+	the buffer is cleared. For 90 and 270 the panel width must be a multiple
+	of 8.
+
+	@param[in] p : instance of display
+	@param[in] rotation : new rotation
+
+	@return false if the rotation is not possible for this panel
+*/
+bool ssd1306_set_rotation(ssd1306_t *p, ssd1306_rotation_t rotation);
+
+/**
+	@brief transpose an 8x8 bit block
+
+	dst[k*dst_step] bit b = src[b*step] bit k. Uses three masked delta swaps
+	on two 32 bit words instead of 64 single-bit moves. Negative steps walk
+	backwards, which mirrors the block.
+
+	@param[in] src : first source byte
+	@param[in] step : distance between source bytes
+	@param[out] dst : first destination byte
+	@param[in] dst_step : distance between destination bytes
+*/
+void ssd1306_transpose8(const uint8_t *src, int32_t step, uint8_t *dst, int32_t dst_step);
+
+/**
+	@brief build one panel page from a 90/270 rotated buffer
+
+	Used by ssd1306_show; exposed so the transpose cost can be benchmarked
+	without the I2C transfer.
+
+	@param[in] p : instance of display, rotated by 90 or 270
+	@param[in] page : panel page, 0 .. p->width/8-1
+	@param[out] dst : p->height bytes, one per panel column
+*/
+void ssd1306_transpose_page(const ssd1306_t *p, uint32_t page, uint8_t *dst);
+
 /**
 	@brief display buffer, should be called on change
 
+	In strip mode only the page currently held in the buffer is sent.
+
 	@param[in] p : instance of display
 
 */
 void ssd1306_show(ssd1306_t *p);
 
+/**
+	@brief draw and send a whole frame
+
+	With a full buffer: clear, draw(p, ctx), show. In strip mode draw is
+	called once per page with the buffer mapped to that page, and each page
+	is sent right after it is drawn. draw must produce the same frame on
+	every call and must not call ssd1306_show.
+
+	@param[in] p : instance of display
+	@param[in] draw : draws the frame
+	@param[in] ctx : passed to draw
+*/
+void ssd1306_render(ssd1306_t *p, ssd1306_draw_cb_t draw, void *ctx);
+
+/**
+	@brief send a rectangle of the buffer, should be called on partial change
+
+	Only columns x0..x1 of pages page0..page1 are transferred, through the
+	controller's column and page address window. With a 90/270 rotation the
+	whole buffer is sent. In strip mode pages not held in the buffer are
+	skipped.
+
+	@param[in] p : instance of display
+	@param[in] x0 : first column
+	@param[in] x1 : last column (inclusive)
+	@param[in] page0 : first page
+	@param[in] page1 : last page (inclusive)
+*/
+void ssd1306_show_area(ssd1306_t *p, uint32_t x0, uint32_t x1, uint32_t page0, uint32_t page1);
+
 /**
 	@brief clear display buffer
 
@@ -205,6 +613,153 @@ void ssd1306_draw_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, u
 */
 void ssd1306_draw_empty_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
 
+/**
+	@brief draw a horizontal run of pixels
+
+	Sets one bit in a byte per column, the same mask all along the run.
+	Clipped to the display.
+
+	@param[in] p : instance of display
+	@param[in] x0 : first column
+	@param[in] x1 : last column (inclusive)
+	@param[in] y : row
+*/
+void ssd1306_draw_span(ssd1306_t *p, int32_t x0, int32_t x1, int32_t y);
+
+/**
+	@brief draw circle outline (midpoint algorithm)
+
+	Circles, ellipses and rounded rectangles may stick out of the display;
+	what falls outside is clipped.
+
+	@param[in] p : instance of display
+	@param[in] cx : x of center
+	@param[in] cy : y of center
+	@param[in] r : radius
+*/
+void ssd1306_draw_circle(ssd1306_t *p, int32_t cx, int32_t cy, uint32_t r);
+
+/**
+	@brief draw filled circle, as horizontal spans
+
+	@param[in] p : instance of display
+	@param[in] cx : x of center
+	@param[in] cy : y of center
+	@param[in] r : radius
+*/
+void ssd1306_fill_circle(ssd1306_t *p, int32_t cx, int32_t cy, uint32_t r);
+
+/**
+	@brief draw ellipse outline (midpoint algorithm)
+
+	@param[in] p : instance of display
+	@param[in] cx : x of center
+	@param[in] cy : y of center
+	@param[in] rx : horizontal radius
+	@param[in] ry : vertical radius
+*/
+void ssd1306_draw_ellipse(ssd1306_t *p, int32_t cx, int32_t cy, uint32_t rx, uint32_t ry);
+
+/**
+	@brief draw filled ellipse, as horizontal spans
+
+	@param[in] p : instance of display
+	@param[in] cx : x of center
+	@param[in] cy : y of center
+	@param[in] rx : horizontal radius
+	@param[in] ry : vertical radius
+*/
+void ssd1306_fill_ellipse(ssd1306_t *p, int32_t cx, int32_t cy, uint32_t rx, uint32_t ry);
+
+/**
+	@brief draw part of a circle outline
+
+	Angles are in degrees, clockwise from 3 o'clock (y grows downwards); the
+	arc runs clockwise from start to end. start==end draws the whole circle.
+
+	@param[in] p : instance of display
+	@param[in] cx : x of center
+	@param[in] cy : y of center
+	@param[in] r : radius
+	@param[in] start : angle of the first point
+	@param[in] end : angle of the last point
+*/
+void ssd1306_draw_arc(ssd1306_t *p, int32_t cx, int32_t cy, uint32_t r, uint32_t start, uint32_t end);
+
+/**
+	@brief draw rounded rectangle outline
+
+	Covers x..x+width-1 and y..y+height-1, like ssd1306_draw_square. The
+	radius is limited so the corners do not overlap.
+
+	@param[in] p : instance of display
+	@param[in] x : x position of starting point
+	@param[in] y : y position of starting point
+	@param[in] width : width of rectangle
+	@param[in] height : height of rectangle
+	@param[in] r : corner radius
+*/
+void ssd1306_draw_round_rect(ssd1306_t *p, int32_t x, int32_t y, uint32_t width, uint32_t height, uint32_t r);
+
+/**
+	@brief draw filled rounded rectangle
+
+	The part between the corners is filled a page byte at a time, the
+	corners as horizontal spans.
+
+	@param[in] p : instance of display
+	@param[in] x : x position of starting point
+	@param[in] y : y position of starting point
+	@param[in] width : width of rectangle
+	@param[in] height : height of rectangle
+	@param[in] r : corner radius
+*/
+void ssd1306_fill_round_rect(ssd1306_t *p, int32_t x, int32_t y, uint32_t width, uint32_t height, uint32_t r);
+
+/**
+	@brief draw filled polygon
+
+	Scanline fill with an active edge table and fixed point edge stepping,
+	even-odd rule, sampled at pixel centers: polygons sharing an edge do
+	not overlap. Rows are written as runs, one masked byte per column.
+
+	@param[in] p : instance of display
+	@param[in] points : vertices, in order (the last joins the first)
+	@param[in] n : number of vertices, 3..SSD1306_POLY_MAX_POINTS
+	@param[in] clip : rectangle the fill is limited to, or NULL for the whole display
+*/
+void ssd1306_fill_polygon(ssd1306_t *p, const ssd1306_point_t *points, uint32_t n, const ssd1306_rect_t *clip);
+
+/**
+	@brief draw filled polygon, moved and scaled
+
+	For icons kept as one outline and drawn at any size: vertex i lands on
+	x + points[i].x*scale/256, y + points[i].y*scale/256, with 1/16 pixel
+	precision.
+
+	@param[in] p : instance of display
+	@param[in] points : vertices of the outline
+	@param[in] n : number of vertices, 3..SSD1306_POLY_MAX_POINTS
+	@param[in] x : where the outline origin goes
+	@param[in] y : where the outline origin goes
+	@param[in] scale : size factor, 256 = one pixel per unit
+	@param[in] clip : rectangle the fill is limited to, or NULL for the whole display
+*/
+void ssd1306_fill_polygon_scaled(ssd1306_t *p, const ssd1306_point_t *points, uint32_t n, int32_t x, int32_t y, uint32_t scale, const ssd1306_rect_t *clip);
+
+/**
+	@brief draw filled triangle
+
+	@param[in] p : instance of display
+	@param[in] x0 : first vertex
+	@param[in] y0 : first vertex
+	@param[in] x1 : second vertex
+	@param[in] y1 : second vertex
+	@param[in] x2 : third vertex
+	@param[in] y2 : third vertex
+*/
+void ssd1306_fill_triangle(ssd1306_t *p, int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2);
+
 /**
 	@brief draw monochrome bitmap with offset
 
@@ -248,9 +803,27 @@ void ssd1306_draw_char_with_font(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t
 */
 void ssd1306_draw_char(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, char c);
 
+/**
+	@brief draw a Unicode code point with builtin font
+
+	Latin-1 and the symbols of ssd1306_charmap_latin1 are supported; any other
+	code point is drawn as '?'.
+
+	@param[in] p : instance of display
+	@param[in] x : x starting position of char
+	@param[in] y : y starting position of char
+	@param[in] scale : scale font to n times of original size (default should be 1)
+	@param[in] cp : code point to draw
+*/
+void ssd1306_draw_codepoint(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, uint32_t cp);
+
 /**
 	@brief draw string with given font
 
+	The string is decoded as UTF-8. Characters outside ASCII are looked up in
+	ssd1306_charmap_latin1 when font is the builtin font and drawn as '?'
+	otherwise or when the font has no glyph for them.
+
 	@param[in] p : instance of display
 	@param[in] x : x starting position of text
 	@param[in] y : y starting position of text
@@ -261,7 +834,7 @@ void ssd1306_draw_char(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, cha
 void ssd1306_draw_string_with_font(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, const char *s );
 
 /**
-	@brief draw string with builtin font
+	@brief draw UTF-8 string with builtin font
 
 	@param[in] p : instance of display
 	@param[in] x : x starting position of text
@@ -271,4 +844,75 @@ void ssd1306_draw_string_with_font(ssd1306_t *p, uint32_t x, uint32_t y, uint32_
 */
 void ssd1306_draw_string(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const char *s);
 
+/**
+	@brief draw one character with a proportional font
+
+	@param[in] p : instance of display
+	@param[in] x : x position of the glyph's left edge
+	@param[in] y : y position of the glyph's top edge
+	@param[in] font : proportional font
+	@param[in] c : character to draw
+
+	@return horizontal advance of the character (0 if not in the font)
+*/
+uint32_t ssd1306_draw_char_font(ssd1306_t *p, uint32_t x, uint32_t y, const ssd1306_font_t *font, char c);
+
+/**
+	@brief draw UTF-8 string with a proportional font
+
+	Characters missing from the font are drawn as '?'.
+
+	@param[in] p : instance of display
+	@param[in] x : x starting position of text
+	@param[in] y : y starting position of text
+	@param[in] font : proportional font
+	@param[in] s : text to draw
+
+	@return width of the drawn text
+*/
+uint32_t ssd1306_draw_text(ssd1306_t *p, uint32_t x, uint32_t y, const ssd1306_font_t *font, const char *s);
+
+/**
+	@brief draw string anchored left, centered or right at x
+
+	The width comes from ssd1306_text_width_cached, so redrawing the same
+	text every frame costs no extra pass over the glyph table.
+
+	@param[in] p : instance of display
+	@param[in] x : anchor position
+	@param[in] y : y starting position of text
+	@param[in] font : proportional font
+	@param[in] align : which part of the text sits at x
+	@param[in] s : text to draw
+
+	@return width of the drawn text
+*/
+uint32_t ssd1306_draw_text_aligned(ssd1306_t *p, uint32_t x, uint32_t y, const ssd1306_font_t *font, ssd1306_align_t align, const char *s);
+
+/**
+	@brief measure the advance width of a string
+
+	@param[in] font : proportional font
+	@param[in] s : text to measure
+
+	@return sum of the advances of all characters
+*/
+uint32_t ssd1306_text_width(const ssd1306_font_t *font, const char *s);
+
+/**
+	@brief measure a string through a small cache keyed by font and content
+
+	Entries keep a copy of the string, found through a 32 bit hash of its
+	bytes and then compared in full, so the same text rebuilt with sprintf
+	into a buffer still hits the cache and a hash collision never returns
+	the width of another string. Strings longer than SSD1306_TEXT_CACHE_LEN
+	bytes bypass the cache.
+
+	@param[in] font : proportional font
+	@param[in] s : text to measure
+
+	@return sum of the advances of all characters
+*/
+uint32_t ssd1306_text_width_cached(const ssd1306_font_t *font, const char *s);
+
 #endif
@@ -0,0 +1,125 @@
+/**
+* @file ssd1306_chart.h
+*
+* Rolling strip chart drawn straight into the page buffer of a display
+*
+* The chart owns a rectangle of whole pages. Appending samples moves the
+* rectangle left with one memmove per page and draws only the new columns,
+* so an append costs the same however much history is on screen. The
+* samples on screen are also kept in a ring buffer, used only when the
+* scale changes and the whole chart must be redrawn.
+*/
+
+#ifndef _inc_ssd1306_chart
+#define _inc_ssd1306_chart
+#include "ssd1306.h"
+
+/**
+*	@brief how each column is drawn
+*/
+typedef enum {
+    SSD1306_CHART_LINE,		/**< one sample per column, joined to the previous column */
+    SSD1306_CHART_ENVELOPE	/**< min..max of the samples of each column as a vertical bar */
+} ssd1306_chart_mode_t;
+
+/**
+*	@brief state of one chart
+*/
+typedef struct {
+    ssd1306_t *disp;		/**< display holding the chart */
+    uint8_t x;				/**< first column of the chart */
+    uint8_t page;			/**< first page of the chart */
+    uint8_t width;			/**< columns, one per sample (line) or per envelope */
+    uint8_t pages;			/**< height in pages */
+    uint8_t mode;			/**< ssd1306_chart_mode_t */
+    bool autoscale;			/**< grow (and shrink) the range to fit the samples */
+    int32_t min;			/**< value drawn at the bottom row */
+    int32_t max;			/**< value drawn at the top row */
+    int32_t *lo;			/**< ring buffer of the column minimums, width+1 entries */
+    int32_t *hi;			/**< ring buffer of the column maximums, width+1 entries */
+    uint16_t head;			/**< ring index of the next column */
+    uint16_t count;			/**< columns stored, up to width+1 (one scrolled out) */
+    uint16_t until_fit;		/**< appends left before the autoscale range is checked for shrinking */
+    uint32_t redraws;		/**< full redraws caused by a change of scale */
+} ssd1306_chart_t;
+
+/**
+*	@brief set up a chart on a region of the display
+*
+*	The region is cleared. Starts in autoscale mode.
+*
+*	@param[out] c : chart to initialize
+*	@param[in] p : display with a full buffer (not in strip mode)
+*	@param[in] x : first column
+*	@param[in] page : first page
+*	@param[in] width : columns
+*	@param[in] pages : height in pages
+*	@param[in] mode : ssd1306_chart_mode_t
+*
+*	@return false if the region is outside the display or out of memory
+*/
+bool ssd1306_chart_init(ssd1306_chart_t *c, ssd1306_t *p, uint32_t x, uint32_t page, uint32_t width, uint32_t pages, ssd1306_chart_mode_t mode);
+
+/**
+*	@brief free the history of a chart
+*
+*	@param[in] c : chart
+*/
+void ssd1306_chart_deinit(ssd1306_chart_t *c);
+
+/**
+*	@brief fix the range of the chart, or go back to autoscale
+*
+*	Redraws the chart. Samples outside a fixed range are clipped to the
+*	top or bottom row.
+*
+*	@param[in] c : chart
+*	@param[in] min : value of the bottom row
+*	@param[in] max : value of the top row (> min)
+*	@param[in] autoscale : false to keep min..max fixed
+*/
+void ssd1306_chart_set_range(ssd1306_chart_t *c, int32_t min, int32_t max, bool autoscale);
+
+/**
+*	@brief append samples, one column each
+*
+*	Shifts the chart left once by n columns and draws the n new ones.
+*
+*	@param[in] c : chart
+*	@param[in] values : samples, oldest first
+*	@param[in] n : number of samples
+*/
+void ssd1306_chart_push_n(ssd1306_chart_t *c, const int32_t *values, uint32_t n);
+
+/**
+*	@brief append one sample
+*
+*	@param[in] c : chart
+*	@param[in] value : sample
+*/
+void ssd1306_chart_push(ssd1306_chart_t *c, int32_t value);
+
+/**
+*	@brief append one column summarizing several samples
+*
+*	@param[in] c : chart
+*	@param[in] lo : smallest sample of the column
+*	@param[in] hi : largest sample of the column
+*/
+void ssd1306_chart_push_envelope(ssd1306_chart_t *c, int32_t lo, int32_t hi);
+
+/**
+*	@brief redraw the whole chart from its history
+*
+*	@param[in] c : chart
+*/
+void ssd1306_chart_redraw(ssd1306_chart_t *c);
+
+/**
+*	@brief send only the chart region to the display
+*
+*	@param[in] c : chart
+*/
+void ssd1306_chart_show(ssd1306_chart_t *c);
+
+#endif
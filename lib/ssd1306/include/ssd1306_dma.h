@@ -0,0 +1,85 @@
+/**
+* @file ssd1306_dma.h
+*
+* DMA flush of one or more ssd1306 displays
+*
+* Each display gets a DMA channel paced by the TX DREQ of its i2c
+* controller. ssd1306_dma_show_all() sends the frames of all displays
+* together: transfers on different controllers (i2c0 and i2c1) run at the
+* same time, displays sharing a controller are sent one after the other.
+*/
+
+#ifndef _inc_ssd1306_dma
+#define _inc_ssd1306_dma
+#include "ssd1306.h"
+
+/**
+*	@brief DMA state of one display
+*
+*	A frame goes out as one transfer for the address window followed by one
+*	transfer per page, each written to IC_DATA_CMD as 16 bit words (data
+*	byte plus the STOP flag on the last one).
+*/
+typedef struct {
+    ssd1306_t *disp;		/**< display flushed through this channel */
+    int chan;				/**< DMA channel claimed by ssd1306_dma_init */
+    uint8_t step;			/**< next transfer of the current flush (0: address window) */
+    bool active;			/**< a transfer of this display is in flight */
+    int8_t error;			/**< 0, or PICO_ERROR_GENERIC (NACK) / PICO_ERROR_TIMEOUT of the current flush */
+    uint32_t bytes;			/**< bytes queued in the current flush */
+    uint32_t deadline;		/**< time_us_32() by which the transfer in flight must be done */
+    uint16_t words[1+128];	/**< transfer being sent, as IC_DATA_CMD words */
+} ssd1306_dma_t;
+
+/**
+*	@brief claim a DMA channel for a display
+*
+*	@param[out] d : DMA state to initialize
+*	@param[in] p : display, initialized with ssd1306_init (full buffer)
+*
+*	@return false if p is in strip mode, is page addressed (SH1106) or no DMA
+*	channel is free
+*/
+bool ssd1306_dma_init(ssd1306_dma_t *d, ssd1306_t *p);
+
+/**
+*	@brief release the DMA channel
+*
+*	@param[in] d : DMA state
+*/
+void ssd1306_dma_deinit(ssd1306_dma_t *d);
+
+/**
+*	@brief send the buffers of several displays together
+*
+*	Blocks until every frame has left the i2c controllers. Calls
+*	ssd1306_i2c_hook once per display with the bytes of its frame. Every
+*	transfer has a deadline scaled to its length; a display that times out
+*	(bus recovered) or is not acknowledged skips the rest of its frame as
+*	soon as the transfer in flight has been handed to the controller, so
+*	the call never takes longer than ssd1306_dma_show_bound_us. The frame is
+*	not retried: the next flush sends it whole.
+*
+*	@param[in] d : DMA states of the displays
+*	@param[in] n : number of displays
+*/
+void ssd1306_dma_show_all(ssd1306_dma_t *d, size_t n);
+
+/**
+*	@brief worst case time of ssd1306_dma_show_all
+*
+*	@param[in] d : DMA states of the displays
+*	@param[in] n : number of displays
+*
+*	@return bound in microseconds
+*/
+uint32_t ssd1306_dma_show_bound_us(const ssd1306_dma_t *d, size_t n);
+
+/**
+*	@brief send the buffer of one display through DMA
+*
+*	@param[in] d : DMA state of the display
+*/
+void ssd1306_dma_show(ssd1306_dma_t *d);
+
+#endif
@@ -0,0 +1,141 @@
+/**
+* @file ssd1306_gray.h
+*
+* Gray levels on a monochrome display by temporal dithering
+*
+* Every pixel has a 2 bit level (0 off .. 3 full on) kept in two bit
+* planes laid out like the display buffer. A gray cycle is
+* SSD1306_GRAY_PHASES frames; in frame k the pixels with a level above k
+* are lit, so a pixel is on for level/3 of the cycle. The frames must be
+* sent at a steady, fast rate for the eye to blend them: each frame is
+* built a word at a time into the display buffer and only the pages that
+* differ from the previous frame are sent, so pages without gray pixels
+* cost nothing after the first cycle.
+*
+* Shapes are drawn with the usual functions into a pen canvas and then
+* painted into the planes with a level.
+*/
+
+#ifndef _inc_ssd1306_gray
+#define _inc_ssd1306_gray
+#include "ssd1306.h"
+
+/**
+*	@brief levels of a pixel, 0 (off) to SSD1306_GRAY_LEVELS-1 (on)
+*/
+#define SSD1306_GRAY_LEVELS 4
+
+/**
+*	@brief frames in a gray cycle
+*/
+#define SSD1306_GRAY_PHASES (SSD1306_GRAY_LEVELS-1)
+
+/**
+*	@brief 2 bit shadow buffer of a display
+*
+*	lo and hi hold bit 0 and bit 1 of the level of each pixel, with the
+*	layout of the display buffer (one bit per pixel, page-major).
+*/
+typedef struct {
+    ssd1306_t *disp;	/**< display the frames are built for */
+    ssd1306_t pen;		/**< view of the display to draw shapes into before painting them */
+    uint8_t *lo;		/**< bit 0 of the levels */
+    uint8_t *hi;		/**< bit 1 of the levels */
+} ssd1306_gray_t;
+
+/**
+*	@brief set up the shadow buffer of a display, all pixels at level 0
+*
+*	The pen follows the rotation the display has now; set it first.
+*
+*	@param[out] g : shadow buffer to initialize
+*	@param[in] p : display with a full buffer (not in strip mode), width a multiple of 4
+*
+*	@return false if the display does not qualify or out of memory
+*/
+bool ssd1306_gray_init(ssd1306_gray_t *g, ssd1306_t *p);
+
+/**
+*	@brief free the shadow buffer
+*
+*	@param[in] g : shadow buffer
+*/
+void ssd1306_gray_deinit(ssd1306_gray_t *g);
+
+/**
+*	@brief set every pixel to a level
+*
+*	@param[in] g : shadow buffer
+*	@param[in] level : 0..SSD1306_GRAY_LEVELS-1
+*/
+void ssd1306_gray_clear(ssd1306_gray_t *g, uint32_t level);
+
+/**
+*	@brief set one pixel to a level
+*
+*	@param[in] g : shadow buffer
+*	@param[in] x : x position
+*	@param[in] y : y position
+*	@param[in] level : 0..SSD1306_GRAY_LEVELS-1
+*/
+void ssd1306_gray_pixel(ssd1306_gray_t *g, uint32_t x, uint32_t y, uint32_t level);
+
+/**
+*	@brief clear the pen and return it
+*
+*	Draw on the returned canvas with the usual functions, then call
+*	ssd1306_gray_paint.
+*
+*	@param[in] g : shadow buffer
+*
+*	@return g->pen, cleared
+*/
+ssd1306_t *ssd1306_gray_begin(ssd1306_gray_t *g);
+
+/**
+*	@brief set the pixels drawn on the pen to a level
+*
+*	Pixels not drawn on the pen keep their level.
+*
+*	@param[in] g : shadow buffer
+*	@param[in] level : 0..SSD1306_GRAY_LEVELS-1
+*/
+void ssd1306_gray_paint(ssd1306_gray_t *g, uint32_t level);
+
+/**
+*	@brief build frame phase of a gray cycle into the display buffer
+*
+*	The planes may be a copy of those of a shadow buffer (e.g. the one a
+*	refresh loop owns), hence the separate arguments.
+*
+*	@param[in] p : display
+*	@param[in] lo : bit 0 of the levels, p->bufsize bytes, word aligned
+*	@param[in] hi : bit 1 of the levels, p->bufsize bytes, word aligned
+*	@param[in] phase : 0..SSD1306_GRAY_PHASES-1
+*
+*	@return the pages that changed since the previous content of the buffer, bit n for page n
+*/
+uint32_t ssd1306_gray_build(ssd1306_t *p, const uint8_t *lo, const uint8_t *hi, uint32_t phase);
+
+/**
+*	@brief send the given pages of the display buffer
+*
+*	Each run of consecutive pages goes out with ssd1306_show_area; with a
+*	90/270 rotation any page sends the whole frame.
+*
+*	@param[in] p : display
+*	@param[in] pages : pages to send, bit n for page n
+*/
+void ssd1306_gray_send(ssd1306_t *p, uint32_t pages);
+
+/**
+*	@brief build frame phase from the shadow buffer and send the pages that changed
+*
+*	@param[in] g : shadow buffer
+*	@param[in] phase : 0..SSD1306_GRAY_PHASES-1
+*
+*	@return the pages sent, bit n for page n
+*/
+uint32_t ssd1306_gray_show(ssd1306_gray_t *g, uint32_t phase);
+
+#endif
@@ -0,0 +1,155 @@
+/**
+* @file ssd1306_layer.h
+*
+* Layers composited into the buffer of a display
+*
+* The screen is drawn into a base layer; overlays (alerts, popups) are
+* drawn into their own layers, each with a mask of the pixels it covers.
+* The display buffer is built page by page as
+* out = (out & ~mask) | (pixels & mask), one 32 bit word at a time, and
+* only the pages marked dirty are rebuilt and sent. Showing or hiding an
+* overlay dirties the pages it covers, so the base is never redrawn for it.
+*/
+
+#ifndef _inc_ssd1306_layer
+#define _inc_ssd1306_layer
+#include "ssd1306.h"
+
+/**
+*	@brief overlays a compositor can stack
+*/
+#define SSD1306_LAYERS_MAX 4
+
+/**
+*	@brief an overlay covering a band of pages
+*
+*	canvas and mask are views of the display limited to the band: the
+*	usual drawing functions work on them with display coordinates and clip
+*	everything outside the band.
+*/
+typedef struct {
+    ssd1306_t canvas;	/**< content of the overlay */
+    ssd1306_t mask;		/**< set bits are opaque: the canvas replaces what is below */
+    bool visible;		/**< set with ssd1306_compositor_set_visible */
+} ssd1306_layer_t;
+
+/**
+*	@brief base layer, overlays and the pages waiting to be composited
+*/
+typedef struct {
+    ssd1306_t *disp;	/**< display receiving the composited frame */
+    ssd1306_t base;		/**< view of the display for the base layer, whole frame */
+    ssd1306_layer_t *layers[SSD1306_LAYERS_MAX];	/**< overlays, bottom to top */
+    uint8_t count;		/**< overlays in layers */
+    uint32_t dirty;		/**< pages to composite, bit n for page n */
+    uint32_t composited;	/**< pages composited since init */
+} ssd1306_compositor_t;
+
+/**
+*	@brief set up the base layer of a display
+*
+*	Layers follow the rotation the display has now; set it first.
+*
+*	@param[out] c : compositor to initialize
+*	@param[in] p : display with a full buffer (not in strip mode), width a multiple of 4
+*
+*	@return false if the display does not qualify or out of memory
+*/
+bool ssd1306_compositor_init(ssd1306_compositor_t *c, ssd1306_t *p);
+
+/**
+*	@brief free the base layer
+*
+*	@param[in] c : compositor
+*/
+void ssd1306_compositor_deinit(ssd1306_compositor_t *c);
+
+/**
+*	@brief set up an overlay covering pages page..page+pages-1
+*
+*	Starts cleared (fully transparent) and hidden.
+*
+*	@param[out] l : layer to initialize
+*	@param[in] c : compositor the layer will be added to
+*	@param[in] page : first page covered
+*	@param[in] pages : pages covered
+*
+*	@return false if the band is outside the display or out of memory
+*/
+bool ssd1306_layer_init(ssd1306_layer_t *l, const ssd1306_compositor_t *c, uint32_t page, uint32_t pages);
+
+/**
+*	@brief free an overlay
+*
+*	@param[in] l : layer, removed from its compositor first
+*/
+void ssd1306_layer_deinit(ssd1306_layer_t *l);
+
+/**
+*	@brief clear the content and the mask of an overlay
+*
+*	@param[in] l : layer
+*/
+void ssd1306_layer_clear(ssd1306_layer_t *l);
+
+/**
+*	@brief stack an overlay on top of the others
+*
+*	@param[in] c : compositor
+*	@param[in] l : initialized layer
+*
+*	@return false if SSD1306_LAYERS_MAX overlays are already stacked
+*/
+bool ssd1306_compositor_add(ssd1306_compositor_t *c, ssd1306_layer_t *l);
+
+/**
+*	@brief remove an overlay from the stack
+*
+*	@param[in] c : compositor
+*	@param[in] l : layer
+*/
+void ssd1306_compositor_remove(ssd1306_compositor_t *c, ssd1306_layer_t *l);
+
+/**
+*	@brief show or hide an overlay
+*
+*	Dirties the pages of the overlay if its visibility changes.
+*
+*	@param[in] c : compositor
+*	@param[in] l : layer in the stack
+*	@param[in] visible : new visibility
+*/
+void ssd1306_compositor_set_visible(ssd1306_compositor_t *c, ssd1306_layer_t *l, bool visible);
+
+/**
+*	@brief mark pages page0..page1 for compositing
+*
+*	Call after drawing into the base or into a visible overlay.
+*
+*	@param[in] c : compositor
+*	@param[in] page0 : first page
+*	@param[in] page1 : last page
+*/
+void ssd1306_compositor_invalidate(ssd1306_compositor_t *c, uint32_t page0, uint32_t page1);
+
+/**
+*	@brief composite the dirty pages into the display buffer
+*
+*	@param[in] c : compositor
+*
+*	@return the pages composited, bit n for page n
+*/
+uint32_t ssd1306_compositor_update(ssd1306_compositor_t *c);
+
+/**
+*	@brief composite the dirty pages and send them
+*
+*	Each run of consecutive dirty pages goes out with ssd1306_show_area.
+*
+*	@param[in] c : compositor
+*
+*	@return the pages composited, bit n for page n
+*/
+uint32_t ssd1306_compositor_show(ssd1306_compositor_t *c);
+
+#endif
@@ -32,91 +32,303 @@ SOFTWARE.
 
 #include "ssd1306.h"
 #include "font.h"
+#include "scale_lut.h"
+#include "font_ext.h"
+#include "font_prop.h"
+
+typedef struct {
+    const ssd1306_font_t *font;
+    uint32_t hash;
+    uint16_t len;
+    uint16_t width;
+    char text[SSD1306_TEXT_CACHE_LEN];
+} text_cache_entry_t;
+
+static text_cache_entry_t text_cache[SSD1306_TEXT_CACHE_SIZE];
+static uint32_t text_cache_next;
 
 inline static void swap(int32_t *a, int32_t *b) {
-    int32_t *t=a;
+    int32_t t=*a;
     *a=*b;
-    *b=*t;
+    *b=t;
 }
 
-inline static void fancy_write(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, char *name) {
-    switch(i2c_write_blocking(i2c, addr, src, len, false)) {
-    case PICO_ERROR_GENERIC:
-        printf("[%s] addr not acknowledged!\n", name);
-        break;
-    case PICO_ERROR_TIMEOUT:
-        printf("[%s] timeout!\n", name);
-        break;
-    default:
-        //printf("[%s] wrote successfully %lu bytes!\n", name, len);
-        break;
+__attribute__((weak)) void ssd1306_i2c_hook(size_t len, int result, uint32_t elapsed_us) {
+    (void)len;
+    (void)result;
+    (void)elapsed_us;
+}
+
+/* pins and clock of each i2c controller, for ssd1306_bus_recover */
+typedef struct {
+    uint8_t sda, scl;
+    uint32_t baudrate;
+} bus_config_t;
+
+static bus_config_t bus_config[2];
+
+ssd1306_bus_stats_t ssd1306_bus_stats;
+
+void ssd1306_bus_config(i2c_inst_t *i2c, uint sda, uint scl, uint baudrate) {
+    bus_config_t *b=&bus_config[i2c_hw_index(i2c)];
+    b->sda=sda;
+    b->scl=scl;
+    b->baudrate=baudrate;
+}
+
+void ssd1306_bus_recover(i2c_inst_t *i2c) {
+    bus_config_t *b=&bus_config[i2c_hw_index(i2c)];
+    ++ssd1306_bus_stats.recoveries;
+
+    i2c_deinit(i2c);
+    if(!b->baudrate) { // pins unknown: reset the controller only
+        i2c_init(i2c, 400000);
+        return;
+    }
+
+    // open drain by hand: output low, or input with the pull-up
+    gpio_set_function(b->sda, GPIO_FUNC_SIO);
+    gpio_set_function(b->scl, GPIO_FUNC_SIO);
+    gpio_put(b->sda, 0);
+    gpio_put(b->scl, 0);
+    gpio_set_dir(b->sda, GPIO_IN);
+    gpio_set_dir(b->scl, GPIO_IN);
+
+    // a target stuck in the middle of a byte holds SDA low; clock it out
+    for(uint32_t i=0; i<9 && !gpio_get(b->sda); ++i) {
+        gpio_set_dir(b->scl, GPIO_OUT);
+        busy_wait_us(5);
+        gpio_set_dir(b->scl, GPIO_IN);
+        busy_wait_us(5);
+    }
+
+    // STOP: SDA rises while SCL is high
+    gpio_set_dir(b->scl, GPIO_OUT);
+    gpio_set_dir(b->sda, GPIO_OUT);
+    busy_wait_us(5);
+    gpio_set_dir(b->scl, GPIO_IN);
+    busy_wait_us(5);
+    gpio_set_dir(b->sda, GPIO_IN);
+    busy_wait_us(5);
+
+    gpio_set_function(b->sda, GPIO_FUNC_I2C);
+    gpio_set_function(b->scl, GPIO_FUNC_I2C);
+    i2c_init(i2c, b->baudrate);
+}
+
+uint32_t SSD1306_HOT(ssd1306_write_timeout_us)(size_t len) {
+    return SSD1306_TIMEOUT_BASE_US+SSD1306_TIMEOUT_BYTE_US*len;
+}
+
+/* worst case of fancy_write for len bytes: every attempt times out */
+static uint32_t write_bound_us(size_t len) {
+    return (SSD1306_WRITE_RETRIES+1)*ssd1306_write_timeout_us(len)+SSD1306_WRITE_RETRIES*SSD1306_RECOVERY_US;
+}
+
+void ssd1306_set_transport(ssd1306_t *p, ssd1306_transport_t transport, void *ctx) {
+    p->transport=transport;
+    p->transport_ctx=ctx;
+}
+
+/*
+ * Writes with a deadline scaled to len. A timeout recovers the bus; NACKs and
+ * timeouts are retried up to SSD1306_WRITE_RETRIES times, so a write never
+ * takes longer than write_bound_us(len). With a transport the deadline and
+ * the recovery are up to it.
+ */
+static bool SSD1306_HOT(fancy_write)(ssd1306_t *p, const uint8_t *src, size_t len) {
+    uint32_t timeout=ssd1306_write_timeout_us(len);
+
+    for(uint32_t attempt=0;; ++attempt) {
+        uint32_t start=time_us_32();
+        int result=p->transport?p->transport(p->transport_ctx, p->address, src, len)
+                   :i2c_write_timeout_us(p->i2c_i, p->address, src, len, false, timeout);
+        ssd1306_i2c_hook(len, result, time_us_32()-start);
+        ++ssd1306_bus_stats.writes;
+
+        if(result==(int)len)
+            return true;
+        if(result==PICO_ERROR_TIMEOUT) {
+            ++ssd1306_bus_stats.timeouts;
+            if(!p->transport)
+                ssd1306_bus_recover(p->i2c_i);
+        } else {
+            ++ssd1306_bus_stats.nacks;
+        }
+
+        if(attempt==SSD1306_WRITE_RETRIES) {
+            ++ssd1306_bus_stats.failures;
+            return false;
+        }
+        ++ssd1306_bus_stats.retries;
     }
 }
 
-inline static void ssd1306_write(ssd1306_t *p, uint8_t val) {
+inline static void SSD1306_HOT(ssd1306_write)(ssd1306_t *p, uint8_t val) {
     uint8_t d[2]= {0x00, val};
-    fancy_write(p->i2c_i, p->address, d, 2, "ssd1306_write");
+    fancy_write(p, d, 2);
 }
 
-bool ssd1306_init(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, i2c_inst_t *i2c_instance) {
-    p->width=width;
-    p->height=height;
-    p->pages=height/8;
+const ssd1306_profile_t ssd1306_profile_128x64= {SSD1306_CTRL_SSD1306, 128, 64, 0, 0x12, 0};
+const ssd1306_profile_t ssd1306_profile_128x32= {SSD1306_CTRL_SSD1306, 128, 32, 0, 0x02, 0};
+const ssd1306_profile_t ssd1306_profile_72x40= {SSD1306_CTRL_SSD1306, 72, 40, 28, 0x12, 0x30};
+const ssd1306_profile_t sh1106_profile_128x64= {SSD1306_CTRL_SH1106, 128, 64, 2, 0x12, 0};
+const ssd1306_profile_t ssd1309_profile_128x64= {SSD1306_CTRL_SSD1309, 128, 64, 0, 0x12, 0};
+
+/* SSD1306 glass picked by ssd1306_init from the geometry; any other size
+ * is centered in the 128 columns with alternative COM pins */
+static const ssd1306_profile_t ssd1306_profile_96x16= {SSD1306_CTRL_SSD1306, 96, 16, 16, 0x02, 0};
+static const ssd1306_profile_t *const known_profiles[]= {
+    &ssd1306_profile_128x64, &ssd1306_profile_128x32, &ssd1306_profile_72x40, &ssd1306_profile_96x16
+};
+
+/* init values that depend on the controller only */
+typedef struct {
+    uint8_t clk_div;
+    uint8_t vcom_desel;
+} controller_timing_t;
+
+static const controller_timing_t controller_timing[]= {
+    [SSD1306_CTRL_SSD1306]= {0x80, 0x30},
+    [SSD1306_CTRL_SH1106]= {0x80, 0x35},
+    [SSD1306_CTRL_SSD1309]= {0xA0, 0x34},
+};
+
+/* SH1106 has no horizontal addressing: every page needs its own page/column command */
+static inline bool page_addressed(const ssd1306_t *p) {
+    return p->profile.controller==SSD1306_CTRL_SH1106;
+}
+
+static bool init_with_pages(ssd1306_t *p, const ssd1306_profile_t *profile, uint8_t address, i2c_inst_t *i2c_instance, bool strip) {
+    p->profile=*profile;
+    p->width=profile->width;
+    p->height=profile->height;
+    p->pages=p->height/8;
     p->address=address;
 
     p->i2c_i=i2c_instance;
+    p->rotation=SSD1306_ROTATE_0;
+    p->buf_page=0;
+    p->buf_pages=strip?1:p->pages;
+    p->transport=NULL;
 
-
-    p->bufsize=(p->pages)*(p->width);
-    if((p->buffer=malloc(p->bufsize+1))==NULL) {
+    // a word in front of the buffer: write_data borrows the byte before it
+    // for the control byte, and the buffer stays word aligned
+    p->bufsize=(p->buf_pages)*(p->width);
+    if((p->buffer=malloc(p->bufsize+4))==NULL) {
         p->bufsize=0;
         return false;
     }
 
-    ++(p->buffer);
+    p->buffer+=4;
 
     // from https://github.com/makerportal/rpi-pico-ssd1306
-    uint8_t cmds[]= {
-        SET_DISP,
-        // timing and driving scheme
-        SET_DISP_CLK_DIV,
-        0x80,
-        SET_MUX_RATIO,
-        height - 1,
-        SET_DISP_OFFSET,
-        0x00,
-        // resolution and layout
-        SET_DISP_START_LINE,
-        // charge pump
-        SET_CHARGE_PUMP,
-        p->external_vcc?0x10:0x14,
-        SET_SEG_REMAP | 0x01,           // column addr 127 mapped to SEG0
-        SET_COM_OUT_DIR | 0x08,         // scan from COM[N] to COM0
-        SET_COM_PIN_CFG,
-        width>2*height?0x02:0x12,
-        // display
-        SET_CONTRAST,
-        0xff,
-        SET_PRECHARGE,
-        p->external_vcc?0x22:0xF1,
-        SET_VCOM_DESEL,
-        0x30,                           // or 0x40?
-        SET_ENTIRE_ON,                  // output follows RAM contents
-        SET_NORM_INV,                   // not inverted
-        SET_DISP | 0x01,
-        // address setting
-        SET_MEM_ADDR,
-        0x00,  // horizontal
-    };
-
-    for(size_t i=0; i<sizeof(cmds); ++i)
+    const controller_timing_t *t=&controller_timing[profile->controller];
+    uint8_t cmds[32];
+    size_t n=0;
+
+    cmds[n++]=SET_DISP;
+    // timing and driving scheme
+    cmds[n++]=SET_DISP_CLK_DIV;
+    cmds[n++]=t->clk_div;
+    cmds[n++]=SET_MUX_RATIO;
+    cmds[n++]=p->height-1;
+    cmds[n++]=SET_DISP_OFFSET;
+    cmds[n++]=0x00;
+    // resolution and layout
+    cmds[n++]=SET_DISP_START_LINE;
+    // supply: charge pump, DC-DC converter or external VCC only
+    switch(profile->controller) {
+    case SSD1306_CTRL_SSD1306:
+        cmds[n++]=SET_CHARGE_PUMP;
+        cmds[n++]=p->external_vcc?0x10:0x14;
+        if(profile->iref) {
+            cmds[n++]=SET_IREF_DCDC;
+            cmds[n++]=profile->iref;
+        }
+        break;
+    case SSD1306_CTRL_SH1106:
+        cmds[n++]=SET_IREF_DCDC;
+        cmds[n++]=p->external_vcc?0x8A:0x8B;
+        break;
+    default:
+        break;
+    }
+    cmds[n++]=SET_SEG_REMAP|0x01;           // column addr 127 mapped to SEG0
+    cmds[n++]=SET_COM_OUT_DIR|0x08;         // scan from COM[N] to COM0
+    cmds[n++]=SET_COM_PIN_CFG;
+    cmds[n++]=profile->com_pins;
+    // display
+    cmds[n++]=SET_CONTRAST;
+    cmds[n++]=0xff;
+    cmds[n++]=SET_PRECHARGE;
+    cmds[n++]=p->external_vcc?0x22:0xF1;
+    cmds[n++]=SET_VCOM_DESEL;
+    cmds[n++]=t->vcom_desel;
+    cmds[n++]=SET_ENTIRE_ON;                // output follows RAM contents
+    cmds[n++]=SET_NORM_INV;                 // not inverted
+    cmds[n++]=SET_DISP|0x01;
+    // address setting
+    if(!page_addressed(p)) {
+        cmds[n++]=SET_MEM_ADDR;
+        cmds[n++]=0x00;                     // horizontal
+    }
+
+    for(size_t i=0; i<n; ++i)
         ssd1306_write(p, cmds[i]);
 
     return true;
 }
 
+/* SSD1306 profile for a geometry: a known glass, or centered in the column RAM */
+static ssd1306_profile_t profile_for(uint16_t width, uint16_t height) {
+    for(size_t i=0; i<sizeof(known_profiles)/sizeof(known_profiles[0]); ++i)
+        if(known_profiles[i]->width==width && known_profiles[i]->height==height)
+            return *known_profiles[i];
+
+    ssd1306_profile_t profile= {SSD1306_CTRL_SSD1306, width, height, (128-width)/2, 0x12, 0};
+    return profile;
+}
+
+bool ssd1306_init_profile(ssd1306_t *p, const ssd1306_profile_t *profile, uint8_t address, i2c_inst_t *i2c_instance, bool strip) {
+    return init_with_pages(p, profile, address, i2c_instance, strip);
+}
+
+bool ssd1306_init(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, i2c_inst_t *i2c_instance) {
+    ssd1306_profile_t profile=profile_for(width, height);
+    return init_with_pages(p, &profile, address, i2c_instance, false);
+}
+
+bool ssd1306_init_strip(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, i2c_inst_t *i2c_instance) {
+    ssd1306_profile_t profile=profile_for(width, height);
+    return init_with_pages(p, &profile, address, i2c_instance, true);
+}
+
+bool ssd1306_set_rotation(ssd1306_t *p, ssd1306_rotation_t rotation) {
+    bool was_sideways=p->rotation&1, sideways=rotation&1, strip=p->buf_pages<p->pages;
+    uint32_t panel_width=was_sideways?p->height:p->width;
+    uint32_t panel_height=was_sideways?p->width:p->height;
+
+    // the 8x8 transpose needs every page of the frame at once
+    if(rotation>SSD1306_ROTATE_270 || (sideways && ((panel_width&7) || strip)))
+        return false;
+
+    p->rotation=rotation;
+    p->width=sideways?panel_height:panel_width;
+    p->height=sideways?panel_width:panel_height;
+    p->pages=p->height/8;
+    if(!strip)
+        p->buf_pages=p->pages;
+    memset(p->buffer, 0, p->bufsize);
+
+    bool flip=(rotation==SSD1306_ROTATE_180);
+    ssd1306_write(p, SET_SEG_REMAP|(flip?0x00:0x01));
+    ssd1306_write(p, SET_COM_OUT_DIR|(flip?0x00:0x08));
+    return true;
+}
+
 inline void ssd1306_deinit(ssd1306_t *p) {
-    free(p->buffer-1);
+    free(p->buffer-4);
 }
 
 inline void ssd1306_poweroff(ssd1306_t *p) {
@@ -136,23 +348,25 @@ inline void ssd1306_invert(ssd1306_t *p, uint8_t inv) {
     ssd1306_write(p, SET_NORM_INV | (inv & 1));
 }
 
-inline void ssd1306_clear(ssd1306_t *p) {
+inline void SSD1306_HOT(ssd1306_clear)(ssd1306_t *p) {
     memset(p->buffer, 0, p->bufsize);
 }
 
-void ssd1306_clear_pixel(ssd1306_t *p, uint32_t x, uint32_t y) {
-    if(x>=p->width || y>=p->height) return;
+void SSD1306_HOT(ssd1306_clear_pixel)(ssd1306_t *p, uint32_t x, uint32_t y) {
+    uint32_t page=(y>>3)-p->buf_page; // wraps around above the strip
+    if(x>=p->width || page>=p->buf_pages) return;
 
-    p->buffer[x+p->width*(y>>3)]&=~(0x1<<(y&0x07));
+    p->buffer[x+p->width*page]&=~(0x1<<(y&0x07));
 }
 
-void ssd1306_draw_pixel(ssd1306_t *p, uint32_t x, uint32_t y) {
-    if(x>=p->width || y>=p->height) return;
+void SSD1306_HOT(ssd1306_draw_pixel)(ssd1306_t *p, uint32_t x, uint32_t y) {
+    uint32_t page=(y>>3)-p->buf_page; // wraps around above the strip
+    if(x>=p->width || page>=p->buf_pages) return;
 
-    p->buffer[x+p->width*(y>>3)]|=0x1<<(y&0x07); // y>>3==y/8 && y&0x7==y%8
+    p->buffer[x+p->width*page]|=0x1<<(y&0x07); // y>>3==y/8 && y&0x7==y%8
 }
 
-void ssd1306_draw_line(ssd1306_t *p, int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+void SSD1306_HOT(ssd1306_draw_line)(ssd1306_t *p, int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
     if(x1>x2) {
         swap(&x1, &x2);
         swap(&y1, &y2);
@@ -174,59 +388,710 @@ void ssd1306_draw_line(ssd1306_t *p, int32_t x1, int32_t y1, int32_t x2, int32_t
     }
 }
 
-void ssd1306_clear_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+void SSD1306_HOT(ssd1306_clear_square)(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
     for(uint32_t i=0; i<width; ++i)
         for(uint32_t j=0; j<height; ++j)
             ssd1306_clear_pixel(p, x+i, y+j);
 }
 
-void ssd1306_draw_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+void SSD1306_HOT(ssd1306_draw_square)(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
     for(uint32_t i=0; i<width; ++i)
         for(uint32_t j=0; j<height; ++j)
             ssd1306_draw_pixel(p, x+i, y+j);
 }
 
-void ssd1306_draw_empty_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+void SSD1306_HOT(ssd1306_draw_empty_square)(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
     ssd1306_draw_line(p, x, y, x+width, y);
     ssd1306_draw_line(p, x, y+height, x+width, y+height);
     ssd1306_draw_line(p, x, y, x, y+height);
     ssd1306_draw_line(p, x+width, y, x+width, y+height);
 }
 
-void ssd1306_draw_char_with_font(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, char c) {
-    if(c<font[3]||c>font[4])
+/*
+ * Sets rows y0..y1 of columns x0..x1, one masked byte per column and page
+ * instead of one read-modify-write per pixel. Clipped to the display and,
+ * in strip mode, to the page held in the buffer.
+ */
+static void SSD1306_HOT(fill_rows)(ssd1306_t *p, int32_t x0, int32_t x1, int32_t y0, int32_t y1) {
+    if(x0<0)
+        x0=0;
+    if(x1>=p->width)
+        x1=p->width-1;
+    if(y0<(int32_t)(p->buf_page*8u))
+        y0=p->buf_page*8u;
+    if(y1>=(int32_t)((p->buf_page+p->buf_pages)*8u))
+        y1=(p->buf_page+p->buf_pages)*8u-1;
+    if(x0>x1 || y0>y1)
+        return;
+
+    uint32_t page0=y0>>3, page1=y1>>3;
+    uint8_t *row=p->buffer+(page0-p->buf_page)*p->width;
+    for(uint32_t page=page0; page<=page1; ++page, row+=p->width) {
+        uint8_t mask=0xFF;
+        if(page==page0)
+            mask&=0xFF<<(y0&7);
+        if(page==page1)
+            mask&=0xFF>>(7-(y1&7));
+        for(int32_t x=x0; x<=x1; ++x)
+            row[x]|=mask;
+    }
+}
+
+void SSD1306_HOT(ssd1306_draw_span)(ssd1306_t *p, int32_t x0, int32_t x1, int32_t y) {
+    fill_rows(p, x0, x1, y, y);
+}
+
+/* Plots the four mirror images of (dx, dy) around the centers of a shape
+ * whose left/right and top/bottom halves are cx0/cx1 and cy0/cy1 apart. */
+static inline void SSD1306_HOT(plot4)(ssd1306_t *p, int32_t cx0, int32_t cx1, int32_t cy0, int32_t cy1, int32_t dx, int32_t dy) {
+    ssd1306_draw_pixel(p, cx1+dx, cy1+dy);
+    ssd1306_draw_pixel(p, cx0-dx, cy1+dy);
+    ssd1306_draw_pixel(p, cx1+dx, cy0-dy);
+    ssd1306_draw_pixel(p, cx0-dx, cy0-dy);
+}
+
+/* Sets rows cy0-dy and cy1+dy from cx0-dx to cx1+dx. */
+static inline void SSD1306_HOT(span2)(ssd1306_t *p, int32_t cx0, int32_t cx1, int32_t cy0, int32_t cy1, int32_t dx, int32_t dy) {
+    fill_rows(p, cx0-dx, cx1+dx, cy0-dy, cy0-dy);
+    fill_rows(p, cx0-dx, cx1+dx, cy1+dy, cy1+dy);
+}
+
+/*
+ * Midpoint circle over one octant: calls back for every (dx, dy) with
+ * dx<=dy on the circle of radius r; last_of_row is set on the last point
+ * before dy changes. Circles, rounded corners and arcs share it and only
+ * differ in how the octant is mirrored.
+ */
+typedef void (*octant_cb_t)(ssd1306_t *p, const void *ctx, int32_t dx, int32_t dy, bool last_of_row);
+
+static void SSD1306_HOT(midpoint_circle)(ssd1306_t *p, const void *ctx, int32_t r, octant_cb_t cb) {
+    int32_t dx=0, dy=r, d=1-r;
+
+    while(dx<=dy) {
+        bool step=d>=0; // dy decreases after this point
+        cb(p, ctx, dx, dy, step || dx==dy);
+        if(step) {
+            d+=2*(dx-dy)+5;
+            --dy;
+        } else {
+            d+=2*dx+3;
+        }
+        ++dx;
+    }
+}
+
+/* ctx: left, right, top and bottom centers (all the same for a circle). */
+static void SSD1306_HOT(outline_octant)(ssd1306_t *p, const void *ctx, int32_t dx, int32_t dy, bool last_of_row) {
+    const int32_t *box=ctx;
+    (void)last_of_row;
+    plot4(p, box[0], box[1], box[2], box[3], dx, dy);
+    plot4(p, box[0], box[1], box[2], box[3], dy, dx);
+}
+
+/* Two spans per octant point: rows cy+-dx always (one point per row), rows
+ * cy+-dy only for the widest point of the row. */
+static void SSD1306_HOT(fill_octant)(ssd1306_t *p, const void *ctx, int32_t dx, int32_t dy, bool last_of_row) {
+    const int32_t *box=ctx;
+    span2(p, box[0], box[1], box[2], box[3], dy, dx);
+    if(last_of_row && dx!=dy)
+        span2(p, box[0], box[1], box[2], box[3], dx, dy);
+}
+
+void SSD1306_HOT(ssd1306_draw_circle)(ssd1306_t *p, int32_t cx, int32_t cy, uint32_t r) {
+    const int32_t box[]= {cx, cx, cy, cy};
+    midpoint_circle(p, box, r, outline_octant);
+}
+
+void SSD1306_HOT(ssd1306_fill_circle)(ssd1306_t *p, int32_t cx, int32_t cy, uint32_t r) {
+    const int32_t box[]= {cx, cx, cy, cy};
+    midpoint_circle(p, box, r, fill_octant);
+}
+
+void SSD1306_HOT(ssd1306_draw_round_rect)(ssd1306_t *p, int32_t x, int32_t y, uint32_t width, uint32_t height, uint32_t r) {
+    if(width==0 || height==0)
+        return;
+    if(2*r>=width) // corner centers must not cross
+        r=(width-1)/2;
+    if(2*r>=height)
+        r=(height-1)/2;
+
+    int32_t x1=x+width-1, y1=y+height-1;
+    fill_rows(p, x+r, x1-r, y, y);
+    fill_rows(p, x+r, x1-r, y1, y1);
+    fill_rows(p, x, x, y+r, y1-r);
+    fill_rows(p, x1, x1, y+r, y1-r);
+    if(r) {
+        const int32_t box[]= {x+r, x1-r, y+r, y1-r};
+        midpoint_circle(p, box, r, outline_octant);
+    }
+}
+
+void SSD1306_HOT(ssd1306_fill_round_rect)(ssd1306_t *p, int32_t x, int32_t y, uint32_t width, uint32_t height, uint32_t r) {
+    if(width==0 || height==0)
+        return;
+    if(2*r>=width) // corner centers must not cross
+        r=(width-1)/2;
+    if(2*r>=height)
+        r=(height-1)/2;
+
+    int32_t x1=x+width-1, y1=y+height-1;
+    fill_rows(p, x, x1, y+r, y1-r); // everything between the corners, page-wise
+    if(r) {
+        const int32_t box[]= {x+r, x1-r, y+r, y1-r};
+        midpoint_circle(p, box, r, fill_octant);
+    }
+}
+
+/*
+ * Midpoint ellipse in two regions (slope above and below -1), 64 bit
+ * decision variables. Calls back once per point in outline mode and once
+ * per row, with the widest point, in fill mode.
+ */
+static void SSD1306_HOT(midpoint_ellipse)(ssd1306_t *p, int32_t cx, int32_t cy, uint32_t rx, uint32_t ry, bool fill) {
+    if(rx==0 || ry==0) { // a line
+        fill_rows(p, cx-rx, cx+rx, cy-ry, cy+ry);
+        return;
+    }
+
+    int64_t rx2=(int64_t)rx*rx, ry2=(int64_t)ry*ry;
+    int64_t dx=0, dy=ry;
+    int64_t px=0, py=2*rx2*dy;
+    int64_t d=ry2-rx2*ry+rx2/4;
+
+    // region 1: x steps every point, y sometimes
+    while(px<py) {
+        bool step=d>=0;
+        if(!fill)
+            plot4(p, cx, cx, cy, cy, dx, dy);
+        else if(step)
+            span2(p, cx, cx, cy, cy, dx, dy);
+        ++dx;
+        px+=2*ry2;
+        if(step) {
+            --dy;
+            py-=2*rx2;
+            d+=px-py+ry2;
+        } else {
+            d+=px+ry2;
+        }
+    }
+
+    // region 2: y steps every point, x sometimes
+    d=ry2*(2*dx+1)*(2*dx+1)/4+rx2*(dy-1)*(dy-1)-rx2*ry2;
+    while(dy>=0) {
+        if(fill)
+            span2(p, cx, cx, cy, cy, dx, dy);
+        else
+            plot4(p, cx, cx, cy, cy, dx, dy);
+        --dy;
+        py-=2*rx2;
+        if(d<=0) {
+            ++dx;
+            px+=2*ry2;
+            d+=px-py+rx2;
+        } else {
+            d+=rx2-py;
+        }
+    }
+}
+
+void SSD1306_HOT(ssd1306_draw_ellipse)(ssd1306_t *p, int32_t cx, int32_t cy, uint32_t rx, uint32_t ry) {
+    midpoint_ellipse(p, cx, cy, rx, ry, false);
+}
+
+void SSD1306_HOT(ssd1306_fill_ellipse)(ssd1306_t *p, int32_t cx, int32_t cy, uint32_t rx, uint32_t ry) {
+    midpoint_ellipse(p, cx, cy, rx, ry, true);
+}
+
+/* sin of 0..90 degrees, scaled by 2^14 */
+static const int16_t sin_q14[91]= {
+    0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+    2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+    5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+    8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384
+};
+
+/* Unit vector of deg degrees clockwise from 3 o'clock (y grows downwards), Q14. */
+static void direction(uint32_t deg, int32_t *x, int32_t *y) {
+    deg%=360;
+    uint32_t q=deg/90, a=deg%90;
+    int32_t s=sin_q14[a], c=sin_q14[90-a];
+    static const int8_t rot[4][4]= {{1, 0, 0, 1}, {0, -1, 1, 0}, {-1, 0, 0, -1}, {0, 1, -1, 0}};
+    *x=rot[q][0]*c+rot[q][1]*s;
+    *y=rot[q][2]*c+rot[q][3]*s;
+}
+
+/* center, start and end directions, sweep over 180 degrees */
+typedef struct {
+    int32_t cx, cy, ax, ay, bx, by;
+    bool wide;
+} arc_t;
+
+/* Whether (dx, dy) lies on the clockwise sweep from a to b, by cross products. */
+static inline bool in_sweep(const arc_t *a, int32_t dx, int32_t dy) {
+    bool after_start=(int64_t)a->ax*dy-(int64_t)a->ay*dx>=0;
+    bool before_end=(int64_t)dx*a->by-(int64_t)dy*a->bx>=0;
+    return a->wide?(after_start || before_end):(after_start && before_end);
+}
+
+static inline void SSD1306_HOT(arc_pixel)(ssd1306_t *p, const arc_t *a, int32_t dx, int32_t dy) {
+    if(in_sweep(a, dx, dy))
+        ssd1306_draw_pixel(p, a->cx+dx, a->cy+dy);
+}
+
+static void SSD1306_HOT(arc_octant)(ssd1306_t *p, const void *ctx, int32_t dx, int32_t dy, bool last_of_row) {
+    const arc_t *a=ctx;
+    (void)last_of_row;
+    arc_pixel(p, a, dx, dy);
+    arc_pixel(p, a, -dx, dy);
+    arc_pixel(p, a, dx, -dy);
+    arc_pixel(p, a, -dx, -dy);
+    arc_pixel(p, a, dy, dx);
+    arc_pixel(p, a, -dy, dx);
+    arc_pixel(p, a, dy, -dx);
+    arc_pixel(p, a, -dy, -dx);
+}
+
+void SSD1306_HOT(ssd1306_draw_arc)(ssd1306_t *p, int32_t cx, int32_t cy, uint32_t r, uint32_t start, uint32_t end) {
+    start%=360;
+    end%=360;
+    uint32_t sweep=(end+360-start)%360;
+    if(sweep==0) {
+        ssd1306_draw_circle(p, cx, cy, r);
         return;
+    }
+
+    arc_t a= {.cx=cx, .cy=cy, .wide=sweep>180};
+    direction(start, &a.ax, &a.ay);
+    direction(end, &a.bx, &a.by);
+    midpoint_circle(p, &a, r, arc_octant);
+}
+
+/*
+ * Polygon edge, for scanlines y0..y1-1. The crossing with the center of
+ * the current scanline is x+rem/dy in 1/16 pixel, stepped exactly from row
+ * to row like a Bresenham line: no rounding drifts, so a row gets the same
+ * pixels whichever scanline the edge started at (strip mode, clipping).
+ */
+typedef struct {
+    int32_t y0, y1;
+    int32_t x, rem, dy;
+    int32_t step, rem_step;	/* 16*dx/dy: quotient and remainder */
+} poly_edge_t;
 
+/* Floor division and the matching remainder (0..d-1), d>0. */
+static inline int32_t floor_div(int64_t n, int32_t d, int32_t *rem) {
+    int64_t q=n/d, r=n%d;
+    if(r<0) {
+        --q;
+        r+=d;
+    }
+    *rem=(int32_t)r;
+    return (int32_t)q;
+}
+
+/* First pixel whose center is at or right of crossing e. */
+static inline int32_t first_pixel(const poly_edge_t *e) {
+    int32_t v=e->x-8;
+    return e->rem?(v>>4)+1:(v+15)>>4;
+}
+
+static inline bool crossing_before(const poly_edge_t *a, const poly_edge_t *b) {
+    if(a->x!=b->x)
+        return a->x<b->x;
+    return (int64_t)a->rem*b->dy<(int64_t)b->rem*a->dy;
+}
+
+/*
+ * Scanline fill of a polygon with vertices in 1/16 pixel. Edges are cut to
+ * the clip window when they are built, so the scan only visits rows and
+ * columns inside it; the edge table is sorted by first scanline and the
+ * active edges by crossing, and each pair of crossings is one run.
+ */
+static void SSD1306_HOT(fill_poly_q4)(ssd1306_t *p, const int32_t *xs, const int32_t *ys, uint32_t n, const ssd1306_rect_t *clip) {
+    if(n<3 || n>SSD1306_POLY_MAX_POINTS)
+        return;
+
+    // clip window: the display (the page held, in strip mode) and the clip rect
+    int32_t cx0=0, cx1=p->width-1;
+    int32_t cy0=p->buf_page*8, cy1=(p->buf_page+p->buf_pages)*8-1;
+    if(clip) {
+        if(clip->x>cx0)
+            cx0=clip->x;
+        if(clip->x+clip->width-1<cx1)
+            cx1=clip->x+clip->width-1;
+        if(clip->y>cy0)
+            cy0=clip->y;
+        if(clip->y+clip->height-1<cy1)
+            cy1=clip->y+clip->height-1;
+    }
+    if(cx0>cx1 || cy0>cy1)
+        return;
+
+    poly_edge_t edges[SSD1306_POLY_MAX_POINTS];
+    uint32_t count=0;
+    for(uint32_t i=0; i<n; ++i) {
+        uint32_t j=(i+1==n)?0:i+1;
+        int32_t xa=xs[i], ya=ys[i], xb=xs[j], yb=ys[j];
+        if(ya==yb)
+            continue;
+        if(ya>yb) {
+            swap(&xa, &xb);
+            swap(&ya, &yb);
+        }
+
+        // scanlines whose center (row + 1/2) lies in [ya, yb)
+        int32_t first=(ya+7)>>4, end=(yb+7)>>4;
+        if(first<cy0)
+            first=cy0;
+        if(end>cy1+1)
+            end=cy1+1;
+        if(first>=end)
+            continue;
+
+        int32_t dx=xb-xa, dy=yb-ya;
+        poly_edge_t e= {.y0=first, .y1=end, .dy=dy};
+        e.x=xa+floor_div((int64_t)(first*16+8-ya)*dx, dy, &e.rem);
+        e.step=floor_div((int64_t)16*dx, dy, &e.rem_step);
+        uint32_t k=count++;
+        for(; k>0 && edges[k-1].y0>first; --k)
+            edges[k]=edges[k-1];
+        edges[k]=e;
+    }
+
+    poly_edge_t *active[SSD1306_POLY_MAX_POINTS];
+    uint32_t nactive=0, next=0;
+    for(int32_t y=count?edges[0].y0:cy1+1; y<=cy1; ++y) {
+        uint32_t kept=0;
+        for(uint32_t i=0; i<nactive; ++i)
+            if(active[i]->y1>y)
+                active[kept++]=active[i];
+        nactive=kept;
+        while(next<count && edges[next].y0==y)
+            active[nactive++]=&edges[next++];
+        if(nactive==0 && next==count)
+            break;
+
+        // crossings barely move between rows: insertion sort
+        for(uint32_t i=1; i<nactive; ++i) {
+            poly_edge_t *e=active[i];
+            uint32_t k=i;
+            for(; k>0 && crossing_before(e, active[k-1]); --k)
+                active[k]=active[k-1];
+            active[k]=e;
+        }
+
+        // pixels whose center lies between two crossings
+        for(uint32_t i=0; i+1<nactive; i+=2) {
+            int32_t a=first_pixel(active[i]), b=first_pixel(active[i+1])-1;
+            if(a<cx0)
+                a=cx0;
+            if(b>cx1)
+                b=cx1;
+            if(a<=b)
+                fill_rows(p, a, b, y, y);
+        }
+        for(uint32_t i=0; i<nactive; ++i) {
+            poly_edge_t *e=active[i];
+            e->x+=e->step;
+            e->rem+=e->rem_step;
+            if(e->rem>=e->dy) {
+                e->rem-=e->dy;
+                ++e->x;
+            }
+        }
+    }
+}
+
+void SSD1306_HOT(ssd1306_fill_polygon)(ssd1306_t *p, const ssd1306_point_t *points, uint32_t n, const ssd1306_rect_t *clip) {
+    int32_t xs[SSD1306_POLY_MAX_POINTS], ys[SSD1306_POLY_MAX_POINTS];
+
+    if(n>SSD1306_POLY_MAX_POINTS)
+        return;
+    for(uint32_t i=0; i<n; ++i) {
+        xs[i]=points[i].x*16;
+        ys[i]=points[i].y*16;
+    }
+    fill_poly_q4(p, xs, ys, n, clip);
+}
+
+void SSD1306_HOT(ssd1306_fill_polygon_scaled)(ssd1306_t *p, const ssd1306_point_t *points, uint32_t n, int32_t x, int32_t y, uint32_t scale, const ssd1306_rect_t *clip) {
+    int32_t xs[SSD1306_POLY_MAX_POINTS], ys[SSD1306_POLY_MAX_POINTS];
+
+    if(n>SSD1306_POLY_MAX_POINTS)
+        return;
+    for(uint32_t i=0; i<n; ++i) { // scale/256 pixels per unit, kept in 1/16 pixel
+        xs[i]=x*16+((points[i].x*(int32_t)scale)>>4);
+        ys[i]=y*16+((points[i].y*(int32_t)scale)>>4);
+    }
+    fill_poly_q4(p, xs, ys, n, clip);
+}
+
+void SSD1306_HOT(ssd1306_fill_triangle)(ssd1306_t *p, int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+    const int32_t xs[]= {x0*16, x1*16, x2*16}, ys[]= {y0*16, y1*16, y2*16};
+    fill_poly_q4(p, xs, ys, 3, NULL);
+}
+
+/*
+ * ORs a vertical strip of <nbits> pixels (bit 0 on top) into column x starting
+ * at row y, a whole page byte at a time. Pages not held in the buffer (strip
+ * mode) are skipped.
+ */
+static inline void SSD1306_HOT(or_column)(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t bits, uint32_t nbits) {
+    uint32_t page=y>>3, shift=y&7, last=(y+nbits-1)>>3;
+    uint32_t top=p->buf_page, end=p->buf_page+p->buf_pages; // pages held in the buffer
+    if(x>=p->width || page>=end || last<top)
+        return;
+    if(last>=end)
+        last=end-1;
+
+    uint8_t chunk=(uint8_t)(bits<<shift);
+    bits>>=8-shift;
+    for(;;) {
+        if(page>=top)
+            p->buffer[x+(page-top)*p->width]|=chunk;
+        if(++page>last)
+            break;
+        chunk=(uint8_t)bits;
+        bits>>=8;
+    }
+}
+
+static inline uint32_t SSD1306_HOT(expand_column)(uint8_t line, uint32_t scale) {
+    switch(scale) {
+    case 1:
+        return line;
+    case 2:
+        return ssd1306_expand_2x[line];
+    case 3:
+        return ssd1306_expand_3x[line];
+    default:
+        return ssd1306_expand_4x[line];
+    }
+}
+
+static void SSD1306_HOT(draw_glyph)(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, const uint8_t *glyph) {
     uint32_t parts_per_line=(font[0]>>3)+((font[0]&7)>0);
+
+    if(scale>=1 && scale<=SSD1306_LUT_MAX_SCALE) {
+        for(uint8_t w=0; w<font[1]; ++w) {
+            for(uint32_t lp=0; lp<parts_per_line; ++lp) {
+                uint32_t bits=expand_column(*glyph++, scale);
+                if(!bits)
+                    continue;
+                for(uint32_t dx=0; dx<scale; ++dx)
+                    or_column(p, x+w*scale+dx, y+(lp<<3)*scale, bits, scale<<3);
+            }
+        }
+        return;
+    }
+
     for(uint8_t w=0; w<font[1]; ++w) { // width
-        uint32_t pp=(c-font[3])*font[1]*parts_per_line+w*parts_per_line+5;
         for(uint32_t lp=0; lp<parts_per_line; ++lp) {
-            uint8_t line=font[pp];
+            uint8_t line=*glyph++;
 
             for(int8_t j=0; j<8; ++j, line>>=1) {
                 if(line & 1)
                     ssd1306_draw_square(p, x+w*scale, y+((lp<<3)+j)*scale, scale, scale);
             }
+        }
+    }
+}
+
+/* Decodes one UTF-8 sequence and advances *s past it. A malformed sequence
+ * consumes only its bad bytes (never the terminator) and returns U+FFFD. */
+static uint32_t SSD1306_HOT(utf8_decode)(const char **s) {
+    const uint8_t *u=(const uint8_t *)*s;
+    uint32_t cp=*u++, n;
 
-            ++pp;
+    if(cp<0x80)
+        n=0;
+    else if(cp>=0xC2 && cp<=0xDF)
+        n=1, cp&=0x1F;
+    else if(cp>=0xE0 && cp<=0xEF)
+        n=2, cp&=0x0F;
+    else if(cp>=0xF0 && cp<=0xF4)
+        n=3, cp&=0x07;
+    else
+        n=0, cp=0xFFFD;
+
+    for(; n; --n, ++u) {
+        if((*u&0xC0)!=0x80) {
+            cp=0xFFFD;
+            break;
         }
+        cp=(cp<<6)|(*u&0x3F);
     }
+
+    *s=(const char *)u;
+    return cp;
+}
+
+/* Extended glyph number + 1 for cp, 0 if the map has none. */
+static inline uint32_t SSD1306_HOT(charmap_lookup)(const ssd1306_charmap_t *map, uint32_t cp) {
+    if(cp>=map->limit)
+        return 0;
+    uint32_t block=map->rows[cp>>5];
+    return block?map->blocks[((block-1)<<5)|(cp&31)]:0;
+}
+
+void SSD1306_HOT(ssd1306_draw_char_with_font)(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, char c) {
+    if(c<font[3]||c>font[4])
+        return;
+
+    uint32_t parts_per_line=(font[0]>>3)+((font[0]&7)>0);
+    draw_glyph(p, x, y, scale, font, font+5+(c-font[3])*font[1]*parts_per_line);
 }
 
-void ssd1306_draw_string_with_font(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, const char *s) {
+/* Draws a non-ASCII code point; ext holds the extended glyphs of the font
+ * in ssd1306_charmap_latin1 order, or is NULL if the font has none. */
+static void SSD1306_HOT(draw_ext_with_font)(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, const uint8_t *ext, uint32_t cp) {
+    uint32_t g=ext?charmap_lookup(&ssd1306_charmap_latin1, cp):0;
+    if(!g) {
+        ssd1306_draw_char_with_font(p, x, y, scale, font, '?');
+        return;
+    }
+
+    uint32_t parts_per_line=(font[0]>>3)+((font[0]&7)>0);
+    draw_glyph(p, x, y, scale, font, ext+(g-1)*font[1]*parts_per_line);
+}
+
+void SSD1306_HOT(ssd1306_draw_string_with_font)(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, const char *s) {
+    const uint8_t *ext=(font==font_8x5)?font_8x5_ext:NULL;
+
+    // strip mode: skip strings that have no row in the buffer (modulo 2^32,
+    // like the pixel clipping, so text starting above row 0 still shows)
+    uint32_t top=p->buf_page*8u;
+    if(y-top>=p->buf_pages*8u && top-y>=font[0]*scale)
+        return;
+
     for(int32_t x_n=x; *s; x_n+=(font[1]+font[2])*scale) {
-        ssd1306_draw_char_with_font(p, x_n, y, scale, font, *(s++));
+        if(!(*s&0x80)) // ASCII: same path as before UTF-8 support
+            ssd1306_draw_char_with_font(p, x_n, y, scale, font, *(s++));
+        else
+            draw_ext_with_font(p, x_n, y, scale, font, ext, utf8_decode(&s));
     }
 }
 
-void ssd1306_draw_char(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, char c) {
+void SSD1306_HOT(ssd1306_draw_char)(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, char c) {
     ssd1306_draw_char_with_font(p, x, y, scale, font_8x5, c);
 }
 
-void ssd1306_draw_string(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const char *s) {
+void SSD1306_HOT(ssd1306_draw_codepoint)(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, uint32_t cp) {
+    if(cp<0x80)
+        ssd1306_draw_char_with_font(p, x, y, scale, font_8x5, (char)cp);
+    else
+        draw_ext_with_font(p, x, y, scale, font_8x5, font_8x5_ext, cp);
+}
+
+void SSD1306_HOT(ssd1306_draw_string)(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const char *s) {
     ssd1306_draw_string_with_font(p, x, y, scale, font_8x5, s);
 }
 
+/* Glyph of a proportional font for cp, NULL if the font has none. */
+static inline const ssd1306_glyph_t *SSD1306_HOT(font_glyph)(const ssd1306_font_t *font, uint32_t cp) {
+    if(cp>=font->first && cp<=font->last)
+        return &font->glyphs[cp-font->first];
+    if(cp<0x80 || !font->map)
+        return NULL;
+    uint32_t g=charmap_lookup(font->map, cp);
+    return g?&font->glyphs[font->last-font->first+g]:NULL;
+}
+
+static uint32_t SSD1306_HOT(draw_glyph_font)(ssd1306_t *p, uint32_t x, uint32_t y, const ssd1306_font_t *font, const ssd1306_glyph_t *g) {
+    const uint8_t *col=font->bitmap+g->offset*font->pages;
+
+    for(uint32_t w=0; w<g->width; ++w, ++x) {
+        for(uint32_t pg=0; pg<font->pages; ++pg, ++col) {
+            if(*col)
+                or_column(p, x, y+(pg<<3), *col, 8);
+        }
+    }
+
+    return g->advance;
+}
+
+uint32_t SSD1306_HOT(ssd1306_draw_char_font)(ssd1306_t *p, uint32_t x, uint32_t y, const ssd1306_font_t *font, char c) {
+    const ssd1306_glyph_t *g=font_glyph(font, (uint8_t)c);
+    return g?draw_glyph_font(p, x, y, font, g):0;
+}
+
+uint32_t SSD1306_HOT(ssd1306_draw_text)(ssd1306_t *p, uint32_t x, uint32_t y, const ssd1306_font_t *font, const char *s) {
+    uint32_t x_n=x;
+    while(*s) {
+        uint32_t cp=(uint8_t)*s;
+        if(cp<0x80)
+            ++s;
+        else
+            cp=utf8_decode(&s);
+
+        const ssd1306_glyph_t *g=font_glyph(font, cp);
+        if(!g && cp>=0x80)
+            g=font_glyph(font, '?');
+        if(g)
+            x_n+=draw_glyph_font(p, x_n, y, font, g);
+    }
+    return x_n-x;
+}
+
+uint32_t SSD1306_HOT(ssd1306_text_width)(const ssd1306_font_t *font, const char *s) {
+    uint32_t width=0;
+    while(*s) {
+        uint32_t cp=(uint8_t)*s;
+        if(cp<0x80)
+            ++s;
+        else
+            cp=utf8_decode(&s);
+
+        const ssd1306_glyph_t *g=font_glyph(font, cp);
+        if(!g && cp>=0x80)
+            g=font_glyph(font, '?');
+        if(g)
+            width+=g->advance;
+    }
+    return width;
+}
+
+uint32_t SSD1306_HOT(ssd1306_text_width_cached)(const ssd1306_font_t *font, const char *s) {
+    uint32_t hash=2166136261u; // FNV-1a
+    uint32_t len=0;
+    for(; s[len]; ++len) {
+        if(len==SSD1306_TEXT_CACHE_LEN)
+            return ssd1306_text_width(font, s);
+        hash=(hash^(uint8_t)s[len])*16777619u;
+    }
+
+    for(uint32_t i=0; i<SSD1306_TEXT_CACHE_SIZE; ++i) {
+        const text_cache_entry_t *e=&text_cache[i];
+        if(e->font==font && e->hash==hash && e->len==len && memcmp(e->text, s, len)==0)
+            return e->width;
+    }
+
+    text_cache_entry_t *e=&text_cache[text_cache_next];
+    text_cache_next=(text_cache_next+1)%SSD1306_TEXT_CACHE_SIZE;
+    e->font=font;
+    e->hash=hash;
+    e->len=len;
+    memcpy(e->text, s, len);
+    e->width=ssd1306_text_width(font, s);
+    return e->width;
+}
+
+uint32_t SSD1306_HOT(ssd1306_draw_text_aligned)(ssd1306_t *p, uint32_t x, uint32_t y, const ssd1306_font_t *font, ssd1306_align_t align, const char *s) {
+    if(align!=SSD1306_ALIGN_LEFT) {
+        uint32_t width=ssd1306_text_width_cached(font, s);
+        uint32_t shift=(align==SSD1306_ALIGN_CENTER)?width/2:width;
+        x=(x>shift)?x-shift:0;
+    }
+    return ssd1306_draw_text(p, x, y, font, s);
+}
+
 static inline uint32_t ssd1306_bmp_get_val(const uint8_t *data, const size_t offset, uint8_t size) {
     switch(size) {
     case 1:
@@ -290,17 +1155,174 @@ inline void ssd1306_bmp_show_image(ssd1306_t *p, const uint8_t *data, const long
     ssd1306_bmp_show_image_with_offset(p, data, size, 0, 0);
 }
 
-void ssd1306_show(ssd1306_t *p) {
-    uint8_t payload[]= {SET_COL_ADDR, 0, p->width-1, SET_PAGE_ADDR, 0, p->pages-1};
-    if(p->width==64) {
-        payload[1]+=32;
-        payload[2]+=32;
+void SSD1306_HOT(ssd1306_transpose8)(const uint8_t *src, int32_t step, uint8_t *dst, int32_t dst_step) {
+    uint32_t x=src[0]|(src[step]<<8)|(src[2*step]<<16)|((uint32_t)src[3*step]<<24);
+    uint32_t y=src[4*step]|(src[5*step]<<8)|(src[6*step]<<16)|((uint32_t)src[7*step]<<24);
+    uint32_t t;
+
+    t=(x^(x>>7))&0x00AA00AA;
+    x^=t^(t<<7);
+    t=(y^(y>>7))&0x00AA00AA;
+    y^=t^(t<<7);
+    t=(x^(x>>14))&0x0000CCCC;
+    x^=t^(t<<14);
+    t=(y^(y>>14))&0x0000CCCC;
+    y^=t^(t<<14);
+    t=(x&0x0F0F0F0F)|((y<<4)&0xF0F0F0F0);
+    y=((x>>4)&0x0F0F0F0F)|(y&0xF0F0F0F0);
+
+    dst[0]=t;
+    dst[dst_step]=t>>8;
+    dst[2*dst_step]=t>>16;
+    dst[3*dst_step]=t>>24;
+    dst[4*dst_step]=y;
+    dst[5*dst_step]=y>>8;
+    dst[6*dst_step]=y>>16;
+    dst[7*dst_step]=y>>24;
+}
+
+void SSD1306_HOT(ssd1306_transpose_page)(const ssd1306_t *p, uint32_t page, uint8_t *dst) {
+    // panel column X is logical row y (270) or height-1-y (90); panel row
+    // 8*page+b is logical column width-1-8*page-b (270) or 8*page+b (90)
+    for(uint32_t q=0; q<p->pages; ++q, dst+=8) {
+        if(p->rotation==SSD1306_ROTATE_270)
+            ssd1306_transpose8(p->buffer+q*p->width+p->width-1-8*page, -1, dst, 1);
+        else
+            ssd1306_transpose8(p->buffer+(p->pages-1-q)*p->width+8*page, 1, dst+7, -1);
     }
+}
 
-    for(size_t i=0; i<sizeof(payload); ++i)
-        ssd1306_write(p, payload[i]);
+/* Sends several commands in one write (control byte 0x00). */
+static void SSD1306_HOT(write_cmds)(ssd1306_t *p, const uint8_t *cmds, size_t n) {
+    uint8_t d[1+8];
+    d[0]=0x00;
+    memcpy(d+1, cmds, n);
+    fancy_write(p, d, n+1);
+}
 
-    *(p->buffer-1)=0x40;
+/* Sends len bytes of display data; the byte before src is borrowed for the
+ * control byte instead of copying the row */
+static void SSD1306_HOT(write_data)(ssd1306_t *p, uint8_t *src, size_t len) {
+    uint8_t saved=src[-1];
+    src[-1]=0x40;
+    fancy_write(p, src-1, len+1);
+    src[-1]=saved;
+}
 
-    fancy_write(p->i2c_i, p->address, p->buffer-1, p->bufsize+1, "ssd1306_show");
+/* Sets the column and page address window (panel coordinates), horizontal addressing. */
+static void SSD1306_HOT(set_window)(ssd1306_t *p, uint32_t x0, uint32_t x1, uint32_t page0, uint32_t page1) {
+    uint32_t offset=p->profile.col_offset;
+    uint8_t cmds[]= {SET_COL_ADDR, x0+offset, x1+offset, SET_PAGE_ADDR, page0, page1};
+    write_cmds(p, cmds, sizeof(cmds));
+}
+
+/* Points the controller at column x0 of page (panel coordinates), page addressing. */
+static void SSD1306_HOT(set_page)(ssd1306_t *p, uint32_t page, uint32_t x0) {
+    uint32_t col=x0+p->profile.col_offset;
+    uint8_t cmds[]= {SET_PAGE_START|page, SET_COL_LOW|(col&0x0F), SET_COL_HIGH|(col>>4)};
+    write_cmds(p, cmds, sizeof(cmds));
+}
+
+uint32_t ssd1306_show_bound_us(const ssd1306_t *p) {
+    bool sideways=p->rotation&1;
+    uint32_t panel_width=sideways?p->height:p->width;
+    uint32_t panel_pages=sideways?p->width/8:p->pages;
+
+    if(page_addressed(p)) // page command and data write per page
+        return panel_pages*(write_bound_us(4)+write_bound_us(panel_width+1));
+
+    uint32_t bound=write_bound_us(7); // address window
+    if(sideways || p->buf_pages<p->pages) // one write per panel page
+        return bound+panel_pages*write_bound_us(panel_width+1);
+    return bound+write_bound_us(p->bufsize+1);
+}
+
+void SSD1306_HOT(ssd1306_show)(ssd1306_t *p) {
+    bool sideways=p->rotation&1, paged=page_addressed(p);
+    uint32_t panel_width=sideways?p->height:p->width;
+    uint32_t panel_pages=sideways?p->width/8:p->buf_pages;
+
+    if(!paged)
+        set_window(p, 0, panel_width-1, p->buf_page, p->buf_page+panel_pages-1);
+
+    if(sideways) {
+        // one page per transfer; horizontal addressing continues on the next page
+        uint8_t line[1+128]; // the controller has 128 columns
+        for(uint32_t page=0; page<panel_pages; ++page) {
+            ssd1306_transpose_page(p, page, line+1);
+            if(paged)
+                set_page(p, page, 0);
+            write_data(p, line+1, panel_width);
+        }
+        return;
+    }
+
+    if(paged) {
+        for(uint32_t page=0; page<panel_pages; ++page) {
+            set_page(p, p->buf_page+page, 0);
+            write_data(p, p->buffer+page*p->width, p->width);
+        }
+        return;
+    }
+
+    write_data(p, p->buffer, p->bufsize);
+}
+
+void SSD1306_HOT(ssd1306_show_area)(ssd1306_t *p, uint32_t x0, uint32_t x1, uint32_t page0, uint32_t page1) {
+    if(p->rotation&1) { // panel pages don't map to buffer pages
+        ssd1306_show(p);
+        return;
+    }
+    // only the pages held in the buffer can be sent
+    if(x1>=p->width)
+        x1=p->width-1;
+    if(page0<p->buf_page)
+        page0=p->buf_page;
+    if(page1>=p->buf_page+p->buf_pages)
+        page1=p->buf_page+p->buf_pages-1;
+    if(x0>x1 || page0>page1)
+        return;
+
+    uint32_t len=x1-x0+1;
+    uint8_t *row=p->buffer+(page0-p->buf_page)*p->width+x0;
+
+    if(page_addressed(p)) {
+        for(uint32_t page=page0; page<=page1; ++page, row+=p->width) {
+            set_page(p, page, x0);
+            write_data(p, row, len);
+        }
+        return;
+    }
+
+    set_window(p, x0, x1, page0, page1);
+    if(len==p->width) { // whole rows are contiguous
+        write_data(p, row, (page1-page0+1)*len);
+        return;
+    }
+    for(uint32_t page=page0; page<=page1; ++page, row+=p->width)
+        write_data(p, row, len);
+}
+
+void SSD1306_HOT(ssd1306_render)(ssd1306_t *p, ssd1306_draw_cb_t draw, void *ctx) {
+    if(p->buf_pages==p->pages) {
+        ssd1306_clear(p);
+        draw(p, ctx);
+        ssd1306_show(p);
+        return;
+    }
+
+    // one window for the whole frame: horizontal addressing moves on to the
+    // next page by itself, so each strip is a single data transfer
+    bool paged=page_addressed(p);
+    if(!paged)
+        set_window(p, 0, p->width-1, 0, p->pages-1);
+    for(uint32_t page=0; page<p->pages; ++page) {
+        p->buf_page=page;
+        memset(p->buffer, 0, p->bufsize);
+        draw(p, ctx);
+        if(paged)
+            set_page(p, page, 0);
+        write_data(p, p->buffer, p->bufsize);
+    }
+    p->buf_page=0;
 }
@@ -0,0 +1,207 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "ssd1306_chart.h"
+
+/* Row of value v in the chart, 0 on top; values outside min..max land on the edge rows. */
+static uint32_t SSD1306_HOT(row_of)(const ssd1306_chart_t *c, int32_t v) {
+    uint32_t h=c->pages*8u;
+
+    if(v<=c->min)
+        return h-1;
+    if(v>=c->max)
+        return 0;
+    return h-1-(uint32_t)(((int64_t)v-c->min)*(h-1)/((int64_t)c->max-c->min));
+}
+
+/*
+ * The ring holds width+1 columns: the extra one is the column that just
+ * scrolled out, which the oldest column on screen is still joined to.
+ */
+static inline uint32_t ring(const ssd1306_chart_t *c, uint32_t back) {
+    return (c->head+c->width+1-back)%(c->width+1u);
+}
+
+/* Columns on screen. */
+static inline uint32_t shown(const ssd1306_chart_t *c) {
+    return c->count<c->width?c->count:c->width;
+}
+
+/* Sets rows y0..y1 (y0<=y1) of chart column col, one masked byte per page. */
+static void SSD1306_HOT(column_span)(ssd1306_chart_t *c, uint32_t col, uint32_t y0, uint32_t y1) {
+    uint32_t stride=c->disp->width, page0=y0>>3, page1=y1>>3;
+    uint8_t *dst=c->disp->buffer+(c->page+page0)*stride+c->x+col;
+
+    for(uint32_t page=page0; page<=page1; ++page, dst+=stride) {
+        uint8_t mask=0xFF;
+        if(page==page0)
+            mask&=0xFF<<(y0&7);
+        if(page==page1)
+            mask&=0xFF>>(7-(y1&7));
+        *dst|=mask;
+    }
+}
+
+/*
+ * Draws history entry idx in column col. In line mode the span is stretched
+ * to reach the previous column, so consecutive samples stay connected.
+ */
+static void SSD1306_HOT(draw_column)(ssd1306_chart_t *c, uint32_t col, uint32_t idx, bool joined) {
+    uint32_t y0=row_of(c, c->hi[idx]), y1=row_of(c, c->lo[idx]);
+
+    if(c->mode==SSD1306_CHART_LINE && joined) {
+        uint32_t prev=(idx+c->width)%(c->width+1u);
+        uint32_t top=row_of(c, c->hi[prev]), bottom=row_of(c, c->lo[prev]);
+        if(bottom<y0)
+            y0=bottom;
+        if(top>y1)
+            y1=top;
+    }
+    column_span(c, col, y0, y1);
+}
+
+static void SSD1306_HOT(clear_region)(ssd1306_chart_t *c) {
+    uint8_t *row=c->disp->buffer+c->page*c->disp->width+c->x;
+    for(uint32_t page=0; page<c->pages; ++page, row+=c->disp->width)
+        memset(row, 0, c->width);
+}
+
+/* Range that fits the history with a quarter of its span as headroom above and below. */
+static void fit(ssd1306_chart_t *c, int32_t *min, int32_t *max) {
+    int64_t lo=INT32_MAX, hi=INT32_MIN;
+    for(uint32_t back=1; back<=shown(c); ++back) {
+        uint32_t idx=ring(c, back);
+        if(c->lo[idx]<lo)
+            lo=c->lo[idx];
+        if(c->hi[idx]>hi)
+            hi=c->hi[idx];
+    }
+    if(c->count==0)
+        lo=hi=0;
+
+    int64_t pad=(hi-lo)/4;
+    if(pad<1)
+        pad=1;
+    lo-=pad;
+    hi+=pad;
+    *min=lo<INT32_MIN?INT32_MIN:(int32_t)lo;
+    *max=hi>INT32_MAX?INT32_MAX:(int32_t)hi;
+}
+
+bool ssd1306_chart_init(ssd1306_chart_t *c, ssd1306_t *p, uint32_t x, uint32_t page, uint32_t width, uint32_t pages, ssd1306_chart_mode_t mode) {
+    // shifting needs the whole region in the buffer
+    if(p->buf_pages<p->pages || width==0 || pages==0 || x+width>p->width || page+pages>p->pages)
+        return false;
+
+    c->lo=malloc(2*(width+1)*sizeof(int32_t));
+    if(c->lo==NULL)
+        return false;
+    c->hi=c->lo+width+1;
+
+    c->disp=p;
+    c->x=x;
+    c->page=page;
+    c->width=width;
+    c->pages=pages;
+    c->mode=mode;
+    c->autoscale=true;
+    c->min=0;
+    c->max=1;
+    c->head=0;
+    c->count=0;
+    c->until_fit=width;
+    c->redraws=0;
+    clear_region(c);
+    return true;
+}
+
+void ssd1306_chart_deinit(ssd1306_chart_t *c) {
+    free(c->lo);
+    c->lo=c->hi=NULL;
+}
+
+void SSD1306_HOT(ssd1306_chart_redraw)(ssd1306_chart_t *c) {
+    clear_region(c);
+    for(uint32_t back=shown(c); back>=1; --back)
+        draw_column(c, c->width-back, ring(c, back), back<c->count);
+}
+
+void ssd1306_chart_set_range(ssd1306_chart_t *c, int32_t min, int32_t max, bool autoscale) {
+    c->autoscale=autoscale;
+    if(autoscale) {
+        fit(c, &min, &max);
+        c->until_fit=c->width;
+    }
+    c->min=min;
+    c->max=max>min?max:min+1;
+    ssd1306_chart_redraw(c);
+}
+
+/*
+ * Stores n columns and draws them. Normally the region moves left by n
+ * columns (one memmove per page) and only the new columns are drawn. With
+ * autoscale the chart is redrawn whole when a sample leaves the range, or,
+ * checked once every width columns, when the history fits in less than half
+ * of it.
+ */
+static void SSD1306_HOT(append)(ssd1306_chart_t *c, const int32_t *lo, const int32_t *hi, uint32_t n) {
+    if(n==0)
+        return;
+    if(n>c->width) { // older samples would scroll out at once
+        lo+=n-c->width;
+        hi+=n-c->width;
+        n=c->width;
+    }
+
+    bool rescale=false;
+    for(uint32_t i=0; i<n; ++i) {
+        c->lo[c->head]=lo[i]<hi[i]?lo[i]:hi[i];
+        c->hi[c->head]=lo[i]<hi[i]?hi[i]:lo[i];
+        if(c->lo[c->head]<c->min || c->hi[c->head]>c->max)
+            rescale|=c->autoscale;
+        c->head=(c->head+1)%(c->width+1u);
+        if(c->count<=c->width)
+            ++c->count;
+    }
+
+    if(c->autoscale && !rescale) {
+        if(c->until_fit<=n) {
+            int32_t min, max;
+            fit(c, &min, &max);
+            rescale=2*((int64_t)max-min)<(int64_t)c->max-c->min;
+            c->until_fit=c->width;
+        } else {
+            c->until_fit-=n;
+        }
+    }
+    if(rescale) {
+        fit(c, &c->min, &c->max);
+        ++c->redraws;
+        ssd1306_chart_redraw(c);
+        return;
+    }
+
+    uint8_t *row=c->disp->buffer+c->page*c->disp->width+c->x;
+    for(uint32_t page=0; page<c->pages; ++page, row+=c->disp->width) {
+        memmove(row, row+n, c->width-n);
+        memset(row+c->width-n, 0, n);
+    }
+    for(uint32_t back=n; back>=1; --back)
+        draw_column(c, c->width-back, ring(c, back), back<c->count);
+}
+
+void SSD1306_HOT(ssd1306_chart_push_n)(ssd1306_chart_t *c, const int32_t *values, uint32_t n) {
+    append(c, values, values, n);
+}
+
+void SSD1306_HOT(ssd1306_chart_push)(ssd1306_chart_t *c, int32_t value) {
+    append(c, &value, &value, 1);
+}
+
+void SSD1306_HOT(ssd1306_chart_push_envelope)(ssd1306_chart_t *c, int32_t lo, int32_t hi) {
+    append(c, &lo, &hi, 1);
+}
+
+void SSD1306_HOT(ssd1306_chart_show)(ssd1306_chart_t *c) {
+    ssd1306_show_area(c->disp, c->x, c->x+c->width-1, c->page, c->page+c->pages-1);
+}
@@ -0,0 +1,210 @@
+#include <pico/stdlib.h>
+#include <hardware/i2c.h>
+#include <hardware/dma.h>
+
+#include "ssd1306_dma.h"
+
+/* Pages the panel receives: with a 90/270 rotation the logical width. */
+static inline uint32_t panel_pages(const ssd1306_t *p) {
+    return (p->rotation&1)?p->width/8:p->pages;
+}
+
+/* Waits until the controller has sent everything queued and released the
+ * bus; false if that takes longer than draining a full TX FIFO should. */
+static bool SSD1306_HOT(wait_idle)(i2c_hw_t *hw) {
+    uint32_t start=time_us_32(), timeout=ssd1306_write_timeout_us(16);
+    while(!(hw->status&I2C_IC_STATUS_TFE_BITS) || (hw->status&I2C_IC_STATUS_MST_ACTIVITY_BITS)) {
+        if(time_us_32()-start>timeout)
+            return false;
+        tight_loop_contents();
+    }
+    return true;
+}
+
+/* Gives up the current flush of d: the rest of its frame is skipped and a
+ * timeout also recovers the bus. The next flush sends the whole frame. */
+static void SSD1306_HOT(fail)(ssd1306_dma_t *d, int error) {
+    d->error=error;
+    d->step=UINT8_MAX;
+    ++ssd1306_bus_stats.failures;
+    if(error==PICO_ERROR_TIMEOUT) {
+        ++ssd1306_bus_stats.timeouts;
+        dma_channel_abort(d->chan);
+        ssd1306_bus_recover(d->disp->i2c_i);
+    } else {
+        ++ssd1306_bus_stats.nacks;
+    }
+}
+
+/* Builds one transaction in d->words: control byte, payload, STOP after the last byte. */
+static uint32_t SSD1306_HOT(load)(ssd1306_dma_t *d, uint8_t control, const uint8_t *src, uint32_t len) {
+    d->words[0]=control;
+    for(uint32_t i=0; i<len; ++i)
+        d->words[1+i]=src[i];
+    d->words[len]|=I2C_IC_DATA_CMD_STOP_BITS;
+    return len+1;
+}
+
+bool ssd1306_dma_init(ssd1306_dma_t *d, ssd1306_t *p) {
+    // one window for the frame needs horizontal addressing
+    if(p->buf_pages<p->pages || p->profile.controller==SSD1306_CTRL_SH1106)
+        return false;
+
+    int chan=dma_claim_unused_channel(false);
+    if(chan<0)
+        return false;
+
+    d->disp=p;
+    d->chan=chan;
+    d->step=0;
+    d->active=false;
+    d->error=0;
+
+    i2c_hw_t *hw=i2c_get_hw(p->i2c_i);
+    hw->dma_cr|=I2C_IC_DMA_CR_TDMAE_BITS;
+
+    dma_channel_config c=dma_channel_get_default_config(chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, i2c_get_dreq(p->i2c_i, true));
+    dma_channel_configure(chan, &c, &hw->data_cmd, d->words, 0, false);
+    return true;
+}
+
+void ssd1306_dma_deinit(ssd1306_dma_t *d) {
+    dma_channel_abort(d->chan);
+    dma_channel_unclaim(d->chan);
+}
+
+/* Queues the next transfer of d: the address window, then one page at a time. */
+static void SSD1306_HOT(start_step)(ssd1306_dma_t *d) {
+    ssd1306_t *p=d->disp;
+    i2c_hw_t *hw=i2c_get_hw(p->i2c_i);
+    bool sideways=p->rotation&1;
+    uint32_t panel_width=sideways?p->height:p->width;
+    uint32_t len;
+
+    if(d->step==0) {
+        // the target address can only change while the controller is idle
+        if(!wait_idle(hw)) {
+            fail(d, PICO_ERROR_TIMEOUT);
+            return;
+        }
+        if(hw->tar!=p->address) {
+            hw->enable=0;
+            hw->tar=p->address;
+            hw->enable=1;
+        }
+        uint32_t offset=p->profile.col_offset;
+        uint8_t window[]= {SET_COL_ADDR, offset, offset+panel_width-1, SET_PAGE_ADDR, 0, panel_pages(p)-1};
+        len=load(d, 0x00, window, sizeof(window));
+    } else if(sideways) {
+        uint8_t line[128];
+        ssd1306_transpose_page(p, d->step-1, line);
+        len=load(d, 0x40, line, panel_width);
+    } else {
+        len=load(d, 0x40, p->buffer+(d->step-1)*p->width, p->width);
+    }
+
+    d->bytes+=len;
+    ++d->step;
+    d->active=true;
+    d->deadline=time_us_32()+ssd1306_write_timeout_us(len);
+    ++ssd1306_bus_stats.writes;
+    dma_channel_transfer_from_buffer_now(d->chan, d->words, len);
+}
+
+/* Waits for the channel of d to hand its last word to the TX FIFO. */
+static bool SSD1306_HOT(wait_transfer)(ssd1306_dma_t *d) {
+    while(dma_channel_is_busy(d->chan)) {
+        if((int32_t)(time_us_32()-d->deadline)>0)
+            return false;
+        tight_loop_contents();
+    }
+    return true;
+}
+
+/* Waits for the last bytes of d on the bus and collects a NACK abort, if any. */
+static void SSD1306_HOT(finish)(ssd1306_dma_t *d) {
+    i2c_hw_t *hw=i2c_get_hw(d->disp->i2c_i);
+
+    if(!wait_idle(hw)) {
+        fail(d, PICO_ERROR_TIMEOUT);
+    } else if(hw->tx_abrt_source) {
+        (void)hw->clr_tx_abrt; // leaves the flushed state so the next frame goes out
+        fail(d, PICO_ERROR_GENERIC);
+    }
+}
+
+void SSD1306_HOT(ssd1306_dma_show_all)(ssd1306_dma_t *d, size_t n) {
+    uint32_t start=time_us_32();
+
+    for(size_t i=0; i<n; ++i) {
+        d[i].step=0;
+        d[i].bytes=0;
+        d[i].error=0;
+    }
+
+    for(;;) {
+        // one transfer per controller at a time; displays sharing a
+        // controller take turns
+        uint32_t busy=0;
+        bool started=false;
+        for(size_t i=0; i<n; ++i) {
+            uint32_t bus=1u<<i2c_hw_index(d[i].disp->i2c_i);
+            if((busy&bus) || d[i].step>panel_pages(d[i].disp))
+                continue;
+            busy|=bus;
+            start_step(&d[i]);
+            started=true;
+        }
+        if(!started)
+            break;
+
+        // the words are in the TX FIFO once the channel is done, so the
+        // buffer can be refilled while the controller is still sending
+        for(size_t i=0; i<n; ++i) {
+            if(!d[i].active)
+                continue;
+            d[i].active=false;
+            i2c_hw_t *hw=i2c_get_hw(d[i].disp->i2c_i);
+            if(!wait_transfer(&d[i])) {
+                fail(&d[i], PICO_ERROR_TIMEOUT);
+            } else if(hw->tx_abrt_source) { // NACK: the controller flushed the FIFO
+                (void)hw->clr_tx_abrt;
+                fail(&d[i], PICO_ERROR_GENERIC);
+            } else if(d[i].step>panel_pages(d[i].disp)) {
+                finish(&d[i]);
+            }
+        }
+    }
+
+    for(size_t i=0; i<n; ++i)
+        ssd1306_i2c_hook(d[i].bytes, d[i].error?d[i].error:(int)d[i].bytes, time_us_32()-start);
+}
+
+uint32_t ssd1306_dma_show_bound_us(const ssd1306_dma_t *d, size_t n) {
+    uint32_t bound=0;
+
+    // each controller sends its displays one after the other; the slowest
+    // controller bounds the whole call
+    for(uint32_t bus=0; bus<2; ++bus) {
+        uint32_t sum=0;
+        for(size_t i=0; i<n; ++i) {
+            const ssd1306_t *p=d[i].disp;
+            if(i2c_hw_index(p->i2c_i)!=bus)
+                continue;
+            uint32_t panel_width=(p->rotation&1)?p->height:p->width;
+            sum+=2*ssd1306_write_timeout_us(16)+ssd1306_write_timeout_us(7)
+                +panel_pages(p)*ssd1306_write_timeout_us(panel_width+1)+SSD1306_RECOVERY_US;
+        }
+        if(sum>bound)
+            bound=sum;
+    }
+    return bound;
+}
+
+void SSD1306_HOT(ssd1306_dma_show)(ssd1306_dma_t *d) {
+    ssd1306_dma_show_all(d, 1);
+}
@@ -0,0 +1,115 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "ssd1306_gray.h"
+
+/* Bits of pages page0..page1. */
+static inline uint32_t page_bits(uint32_t page0, uint32_t page1) {
+    return (UINT32_MAX>>(31-page1))&(UINT32_MAX<<page0);
+}
+
+/* All ones if bit b of level is set, else zero. */
+static inline uint32_t level_bits(uint32_t level, uint32_t b) {
+    return (level>>b)&1?UINT32_MAX:0;
+}
+
+bool ssd1306_gray_init(ssd1306_gray_t *g, ssd1306_t *p) {
+    // whole words per page row, and one bit per page in the page masks
+    if(p->buf_pages<p->pages || (p->width&3) || p->pages>32)
+        return false;
+
+    // both planes and the pen in one block; each stays word aligned
+    uint8_t *buffer=malloc(3*p->bufsize);
+    if(buffer==NULL)
+        return false;
+    memset(buffer, 0, 3*p->bufsize);
+
+    g->disp=p;
+    g->lo=buffer;
+    g->hi=buffer+p->bufsize;
+    g->pen=*p;
+    g->pen.buffer=buffer+2*p->bufsize;
+    return true;
+}
+
+void ssd1306_gray_deinit(ssd1306_gray_t *g) {
+    free(g->lo);
+    g->lo=g->hi=g->pen.buffer=NULL;
+}
+
+void ssd1306_gray_clear(ssd1306_gray_t *g, uint32_t level) {
+    memset(g->lo, level&1?0xFF:0, g->disp->bufsize);
+    memset(g->hi, level&2?0xFF:0, g->disp->bufsize);
+}
+
+void SSD1306_HOT(ssd1306_gray_pixel)(ssd1306_gray_t *g, uint32_t x, uint32_t y, uint32_t level) {
+    const ssd1306_t *p=g->disp;
+    if(x>=p->width || y>=p->height) return;
+
+    uint32_t i=x+p->width*(y>>3);
+    uint8_t bit=0x1<<(y&0x07);
+    g->lo[i]=(g->lo[i]&~bit)|(level&1?bit:0);
+    g->hi[i]=(g->hi[i]&~bit)|(level&2?bit:0);
+}
+
+ssd1306_t *ssd1306_gray_begin(ssd1306_gray_t *g) {
+    ssd1306_clear(&g->pen);
+    return &g->pen;
+}
+
+void SSD1306_HOT(ssd1306_gray_paint)(ssd1306_gray_t *g, uint32_t level) {
+    const uint32_t *pen=(const uint32_t *)g->pen.buffer;
+    uint32_t *lo=(uint32_t *)g->lo, *hi=(uint32_t *)g->hi;
+    uint32_t set_lo=level_bits(level, 0), set_hi=level_bits(level, 1);
+
+    for(uint32_t w=0; w<g->disp->bufsize/4; ++w) {
+        uint32_t m=pen[w];
+        if(m==0)
+            continue;
+        lo[w]=(lo[w]&~m)|(set_lo&m);
+        hi[w]=(hi[w]&~m)|(set_hi&m);
+    }
+}
+
+/*
+ * Frame k lights the pixels whose level is above k: level>=1 is lo|hi,
+ * level>=2 is hi and level 3 is lo&hi. Each page is written a word at a
+ * time and compared with what the buffer held, which is the frame sent
+ * last.
+ */
+uint32_t SSD1306_HOT(ssd1306_gray_build)(ssd1306_t *p, const uint8_t *lo, const uint8_t *hi, uint32_t phase) {
+    uint32_t words=p->width/4, changed=0;
+    const uint32_t *l=(const uint32_t *)lo, *h=(const uint32_t *)hi;
+    uint32_t *out=(uint32_t *)p->buffer;
+
+    for(uint32_t page=0; page<p->pages; ++page) {
+        uint32_t diff=0;
+        for(uint32_t w=0; w<words; ++w, ++l, ++h, ++out) {
+            uint32_t v=phase==0?(*l|*h):phase==1?*h:(*l&*h);
+            diff|=*out^v;
+            *out=v;
+        }
+        if(diff)
+            changed|=1u<<page;
+    }
+    return changed;
+}
+
+void SSD1306_HOT(ssd1306_gray_send)(ssd1306_t *p, uint32_t pages) {
+    if(pages && (p->rotation&1)) { // panel pages don't map to buffer pages
+        ssd1306_show(p);
+        return;
+    }
+    for(uint32_t bits=pages; bits; ) {
+        uint32_t page0=__builtin_ctz(bits);
+        uint32_t run=__builtin_ctz(~(bits>>page0)); // consecutive pages
+        ssd1306_show_area(p, 0, p->width-1, page0, page0+run-1);
+        bits&=~page_bits(page0, page0+run-1);
+    }
+}
+
+uint32_t SSD1306_HOT(ssd1306_gray_show)(ssd1306_gray_t *g, uint32_t phase) {
+    uint32_t pages=ssd1306_gray_build(g->disp, g->lo, g->hi, phase);
+    ssd1306_gray_send(g->disp, pages);
+    return pages;
+}
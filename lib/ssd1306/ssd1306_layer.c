@@ -0,0 +1,157 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "ssd1306_layer.h"
+
+/* Points v at buffer, holding pages page..page+pages-1 of display p. */
+static void view(ssd1306_t *v, const ssd1306_t *p, uint8_t *buffer, uint32_t page, uint32_t pages) {
+    *v=*p;
+    v->buffer=buffer;
+    v->buf_page=page;
+    v->buf_pages=pages;
+    v->bufsize=pages*p->width;
+}
+
+/* Bits of pages page0..page1. */
+static inline uint32_t page_bits(uint32_t page0, uint32_t page1) {
+    return (UINT32_MAX>>(31-page1))&(UINT32_MAX<<page0);
+}
+
+static inline uint32_t layer_bits(const ssd1306_layer_t *l) {
+    return page_bits(l->canvas.buf_page, l->canvas.buf_page+l->canvas.buf_pages-1);
+}
+
+bool ssd1306_compositor_init(ssd1306_compositor_t *c, ssd1306_t *p) {
+    // whole words per page row, and one bit per page in dirty
+    if(p->buf_pages<p->pages || (p->width&3) || p->pages>32)
+        return false;
+
+    uint8_t *buffer=malloc(p->bufsize);
+    if(buffer==NULL)
+        return false;
+    memset(buffer, 0, p->bufsize);
+
+    c->disp=p;
+    view(&c->base, p, buffer, 0, p->pages);
+    c->count=0;
+    c->dirty=page_bits(0, p->pages-1);
+    c->composited=0;
+    return true;
+}
+
+void ssd1306_compositor_deinit(ssd1306_compositor_t *c) {
+    free(c->base.buffer);
+    c->base.buffer=NULL;
+}
+
+bool ssd1306_layer_init(ssd1306_layer_t *l, const ssd1306_compositor_t *c, uint32_t page, uint32_t pages) {
+    const ssd1306_t *p=c->disp;
+    if(pages==0 || page+pages>p->pages)
+        return false;
+
+    // content and mask in one block; rows stay word aligned
+    size_t size=pages*p->width;
+    uint8_t *buffer=malloc(2*size);
+    if(buffer==NULL)
+        return false;
+
+    view(&l->canvas, p, buffer, page, pages);
+    view(&l->mask, p, buffer+size, page, pages);
+    l->visible=false;
+    ssd1306_layer_clear(l);
+    return true;
+}
+
+void ssd1306_layer_deinit(ssd1306_layer_t *l) {
+    free(l->canvas.buffer);
+    l->canvas.buffer=l->mask.buffer=NULL;
+}
+
+void ssd1306_layer_clear(ssd1306_layer_t *l) {
+    memset(l->canvas.buffer, 0, 2*l->canvas.bufsize);
+}
+
+bool ssd1306_compositor_add(ssd1306_compositor_t *c, ssd1306_layer_t *l) {
+    if(c->count>=SSD1306_LAYERS_MAX)
+        return false;
+    c->layers[c->count++]=l;
+    if(l->visible)
+        c->dirty|=layer_bits(l);
+    return true;
+}
+
+void ssd1306_compositor_remove(ssd1306_compositor_t *c, ssd1306_layer_t *l) {
+    for(uint32_t i=0; i<c->count; ++i) {
+        if(c->layers[i]!=l)
+            continue;
+        memmove(&c->layers[i], &c->layers[i+1], (c->count-i-1)*sizeof(c->layers[0]));
+        --c->count;
+        if(l->visible)
+            c->dirty|=layer_bits(l);
+        return;
+    }
+}
+
+void ssd1306_compositor_set_visible(ssd1306_compositor_t *c, ssd1306_layer_t *l, bool visible) {
+    if(l->visible==visible)
+        return;
+    l->visible=visible;
+    c->dirty|=layer_bits(l);
+}
+
+void ssd1306_compositor_invalidate(ssd1306_compositor_t *c, uint32_t page0, uint32_t page1) {
+    if(page1>=c->disp->pages)
+        page1=c->disp->pages-1;
+    if(page0<=page1)
+        c->dirty|=page_bits(page0, page1);
+}
+
+/*
+ * Builds one page of the display buffer: the base, then every visible
+ * overlay covering the page, a word at a time. All buffers are word
+ * aligned and the rows are whole words.
+ */
+static void SSD1306_HOT(composite_page)(ssd1306_compositor_t *c, uint32_t page) {
+    uint32_t width=c->disp->width, words=width/4;
+    uint32_t *out=(uint32_t *)(c->disp->buffer+page*width);
+
+    memcpy(out, c->base.buffer+page*width, width);
+    for(uint32_t i=0; i<c->count; ++i) {
+        const ssd1306_layer_t *l=c->layers[i];
+        uint32_t row=page-l->canvas.buf_page; // wraps around above the band
+        if(!l->visible || row>=l->canvas.buf_pages)
+            continue;
+        const uint32_t *pixels=(const uint32_t *)(l->canvas.buffer+row*width);
+        const uint32_t *mask=(const uint32_t *)(l->mask.buffer+row*width);
+        for(uint32_t w=0; w<words; ++w)
+            out[w]=(out[w]&~mask[w])|(pixels[w]&mask[w]);
+    }
+}
+
+uint32_t SSD1306_HOT(ssd1306_compositor_update)(ssd1306_compositor_t *c) {
+    uint32_t dirty=c->dirty;
+
+    for(uint32_t bits=dirty; bits; bits&=bits-1) {
+        composite_page(c, __builtin_ctz(bits));
+        ++c->composited;
+    }
+    c->dirty=0;
+    return dirty;
+}
+
+uint32_t SSD1306_HOT(ssd1306_compositor_show)(ssd1306_compositor_t *c) {
+    ssd1306_t *p=c->disp;
+    uint32_t dirty=ssd1306_compositor_update(c);
+
+    if(dirty && (p->rotation&1)) { // panel pages don't map to buffer pages
+        ssd1306_show(p);
+        return dirty;
+    }
+    for(uint32_t bits=dirty; bits; ) {
+        uint32_t page0=__builtin_ctz(bits);
+        uint32_t run=__builtin_ctz(~(bits>>page0)); // consecutive dirty pages
+        ssd1306_show_area(p, 0, p->width-1, page0, page0+run-1);
+        bits&=~page_bits(page0, page0+run-1);
+    }
+    return dirty;
+}
@@ -0,0 +1,239 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Escalonamento dinâmico do clock do sistema (clk_sys).
+ *
+ *  @file	    clock_scale.c
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+/* ============================   LIBRARIES  =============================== */
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/sync.h"
+#include "hardware/vreg.h"
+#include "hardware/structs/systick.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "clock_scale.h"
+
+/* =============================   TYPES   ================================= */
+
+typedef struct {
+  uint32_t khz;            // Frequência de clk_sys
+  enum vreg_voltage vreg;  // Tensão mínima do núcleo nessa frequência
+  const char *name;        // Nome usado nos relatórios
+} clock_level_desc_t;
+
+typedef struct {
+  clock_scale_cb_t cb;
+  void *ctx;
+} clock_scale_sub_t;
+
+/* =========================   GLOBAL VARIABLES   ========================== */
+
+static const clock_level_desc_t levels[CLOCK_LEVEL_COUNT] = {
+  [CLOCK_LEVEL_ECO]    = {  48000, VREG_VOLTAGE_1_10, "eco"    },
+  [CLOCK_LEVEL_NORMAL] = { 125000, VREG_VOLTAGE_1_10, "normal" },
+  [CLOCK_LEVEL_BOOST]  = { 200000, VREG_VOLTAGE_1_15, "boost"  },
+};
+
+static clock_scale_sub_t subs[CLOCK_SCALE_MAX_CALLBACKS];
+static uint sub_count = 0;
+
+static clock_level_t current = CLOCK_LEVEL_NORMAL; // Nível atual
+static uint64_t level_since_us = 0;                // Início da permanência no nível atual
+static clock_scale_stats_t stats;                  // Permanência acumulada (níveis anteriores)
+
+/* =======================  DEVELOPMENT OF FUNCTIONS ======================= */
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Reprograma o SysTick (base do tick do FreeRTOS), que conta ciclos
+ *  de clk_sys. Antes do escalonador iniciar não há nada a fazer: o port
+ *  programa o SysTick a partir de clock_get_hz(clk_sys) na partida.
+ ----------------------------------------------------------------------------*/
+static void clock_scale_retime_systick(uint32_t sys_hz)
+{
+  if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED)
+  {
+    return;
+  }
+  systick_hw->rvr = sys_hz / configTICK_RATE_HZ - 1;
+  systick_hw->cvr = 0; // Recomeça o período atual com o novo recarregamento
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Troca clk_sys e notifica os periféricos, sem ajustar a tensão.
+ ----------------------------------------------------------------------------*/
+static bool clock_scale_switch(clock_level_t level)
+{
+  uint32_t sys_hz = levels[level].khz * 1000;
+  uint32_t irq = save_and_disable_interrupts();
+  bool ok;
+
+  for (uint i = 0; i < sub_count; ++i)
+  {
+    subs[i].cb(CLOCK_SCALE_PRE, sys_hz, subs[i].ctx);
+  }
+
+  ok = set_sys_clock_khz(levels[level].khz, false);
+  sys_hz = clock_get_hz(clk_sys); // Em caso de falha o clock anterior continua valendo
+
+  clock_scale_retime_systick(sys_hz);
+  for (uint i = 0; i < sub_count; ++i)
+  {
+    subs[i].cb(CLOCK_SCALE_POST, sys_hz, subs[i].ctx);
+  }
+
+  restore_interrupts(irq);
+  return ok;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Inicializa o serviço e aplica o nível inicial.
+ *  Deve ser chamada antes de registrar callbacks e antes do núcleo 1 ser
+ *  lançado: a troca de clock exige que nenhum outro contexto use os
+ *  periféricos durante a janela com interrupções desabilitadas.
+ *
+ *  @param[in] level : Nível inicial.
+ *
+ *  @return (bool) : false se o nível não pôde ser aplicado.
+ *
+ ----------------------------------------------------------------------------*/
+bool clock_scale_init(clock_level_t level)
+{
+  current = level;
+  level_since_us = time_us_64();
+  stats.level = level;
+
+  vreg_set_voltage(levels[level].vreg);
+  busy_wait_us_32(CLOCK_SCALE_VREG_SETTLE_US);
+  return clock_scale_switch(level);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Registra um callback de retemporização.
+ *  O callback é chamado imediatamente (fase POST) com a frequência atual,
+ *  então o periférico pode derivar seus divisores exclusivamente por ele.
+ *
+ *  @param[in] cb  : Callback chamado antes e depois de cada troca.
+ *  @param[in] ctx : Contexto repassado ao callback.
+ *
+ *  @return (bool) : false se não houver mais espaço.
+ *
+ ----------------------------------------------------------------------------*/
+bool clock_scale_register(clock_scale_cb_t cb, void *ctx)
+{
+  if (cb == NULL || sub_count >= CLOCK_SCALE_MAX_CALLBACKS)
+  {
+    return false;
+  }
+
+  uint32_t irq = save_and_disable_interrupts();
+  subs[sub_count].cb = cb;
+  subs[sub_count].ctx = ctx;
+  ++sub_count;
+  cb(CLOCK_SCALE_POST, clock_get_hz(clk_sys), ctx);
+  restore_interrupts(irq);
+  return true;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Muda o nível de desempenho.
+ *  Ao subir, a tensão do núcleo é elevada (e estabilizada) antes do clock;
+ *  ao descer, só é reduzida depois. A espera da tensão acontece com as
+ *  interrupções habilitadas; apenas a troca do PLL e os callbacks rodam com
+ *  elas desabilitadas. Deve ser chamada pelo contexto dono dos periféricos
+ *  (nenhuma transferência I2C pode estar pela metade).
+ *
+ *  @param[in] level : Novo nível.
+ *
+ *  @return (bool) : false se o nível for inválido ou o PLL recusar a frequência.
+ *
+ ----------------------------------------------------------------------------*/
+bool clock_scale_set(clock_level_t level)
+{
+  if (level >= CLOCK_LEVEL_COUNT)
+  {
+    return false;
+  }
+  if (level == current)
+  {
+    return true;
+  }
+
+  uint64_t start = time_us_64();
+  enum vreg_voltage from_vreg = levels[current].vreg;
+  enum vreg_voltage to_vreg = levels[level].vreg;
+
+  if (to_vreg > from_vreg)
+  {
+    vreg_set_voltage(to_vreg);
+    busy_wait_us_32(CLOCK_SCALE_VREG_SETTLE_US);
+  }
+
+  if (!clock_scale_switch(level))
+  {
+    if (to_vreg > from_vreg)
+    {
+      vreg_set_voltage(from_vreg);
+    }
+    return false;
+  }
+
+  if (to_vreg < from_vreg)
+  {
+    vreg_set_voltage(to_vreg);
+  }
+
+  uint64_t now = time_us_64();
+  uint32_t elapsed = (uint32_t)(now - start);
+
+  stats.time_us[current] += now - level_since_us;
+  level_since_us = now;
+  current = level;
+  stats.level = level;
+  ++stats.transitions;
+  if (elapsed > stats.max_switch_us)
+  {
+    stats.max_switch_us = elapsed;
+  }
+  return true;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Retorna o nível de desempenho atual.
+ ----------------------------------------------------------------------------*/
+clock_level_t clock_scale_get_level(void)
+{
+  return current;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Retorna o nome de um nível ("eco", "normal", "boost").
+ ----------------------------------------------------------------------------*/
+const char *clock_scale_level_name(clock_level_t level)
+{
+  return (level < CLOCK_LEVEL_COUNT) ? levels[level].name : "?";
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Copia as estatísticas, incluindo a permanência no nível atual.
+ *
+ *  @param[out] out : Destino da cópia.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void clock_scale_get_stats(clock_scale_stats_t *out)
+{
+  *out = stats;
+  out->time_us[current] += time_us_64() - level_since_us;
+}
+/* end program */
@@ -0,0 +1,72 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Escalonamento dinâmico do clock do sistema (clk_sys).
+ *            Define níveis de desempenho fixos e troca entre eles de forma
+ *            segura (tensão do núcleo ajustada antes de subir e depois de
+ *            descer). Tudo o que deriva de clk_sys (divisores de PWM, baud
+ *            rate do I2C e da UART, SysTick do FreeRTOS) é recalculado por
+ *            callbacks registrados. Também contabiliza o tempo gasto em cada
+ *            nível.
+ *
+ *  @file	    clock_scale.h
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+#ifndef CLOCK_SCALE_H
+#define CLOCK_SCALE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "pico/stdlib.h"
+
+/* =============================   MACROS   ================================ */
+
+#define CLOCK_SCALE_MAX_CALLBACKS 8    // Periféricos com retemporização registrada
+#define CLOCK_SCALE_VREG_SETTLE_US 1000 // Espera após elevar a tensão do núcleo
+
+/* =============================   TYPES   ================================= */
+
+// Níveis de desempenho, do mais econômico ao mais rápido
+typedef enum {
+  CLOCK_LEVEL_ECO,    //  48 MHz, 1,10 V
+  CLOCK_LEVEL_NORMAL, // 125 MHz, 1,10 V (padrão do SDK)
+  CLOCK_LEVEL_BOOST,  // 200 MHz, 1,15 V
+  CLOCK_LEVEL_COUNT,
+} clock_level_t;
+
+// Fase da troca em que o callback é chamado
+typedef enum {
+  CLOCK_SCALE_PRE,  // Antes da troca: esvaziar transmissões em andamento
+  CLOCK_SCALE_POST, // Depois da troca: recalcular divisores para `sys_hz`
+} clock_scale_phase_t;
+
+/*!
+ *  @brief Callback de retemporização. Chamado com as interrupções
+ *         desabilitadas; `sys_hz` é sempre a frequência do novo nível.
+ */
+typedef void (*clock_scale_cb_t)(clock_scale_phase_t phase, uint32_t sys_hz, void *ctx);
+
+// Estatísticas de permanência por nível
+typedef struct {
+  uint64_t time_us[CLOCK_LEVEL_COUNT]; // Tempo acumulado em cada nível
+  uint32_t transitions;                // Trocas efetivas de nível
+  uint32_t max_switch_us;              // Maior duração de uma troca
+  clock_level_t level;                 // Nível atual
+} clock_scale_stats_t;
+
+/* ========================   FUNCTION PROTOTYPE   ========================= */
+
+bool clock_scale_init(clock_level_t level);
+bool clock_scale_register(clock_scale_cb_t cb, void *ctx);
+bool clock_scale_set(clock_level_t level);
+clock_level_t clock_scale_get_level(void);
+const char *clock_scale_level_name(clock_level_t level);
+void clock_scale_get_stats(clock_scale_stats_t *out);
+
+#endif /* CLOCK_SCALE_H */
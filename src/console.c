@@ -0,0 +1,172 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Console de comandos por linha sobre o stdio (USB/UART).
+ *
+ *  @file	    console.c
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+/* ============================   LIBRARIES  =============================== */
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "console.h"
+
+/* =============================   TYPES   ================================= */
+
+typedef struct {
+  const char *name;
+  const char *help;
+  console_cmd_t fn;
+} console_entry_t;
+
+/* =========================   GLOBAL VARIABLES   ========================== */
+
+static console_entry_t commands[CONSOLE_MAX_COMMANDS];
+static uint command_count = 0;
+
+static char line[CONSOLE_LINE_MAX]; // Linha em montagem
+static uint line_len = 0;
+static bool line_overflow = false;  // Linha atual passou do limite
+
+/* =======================  DEVELOPMENT OF FUNCTIONS ======================= */
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Comando embutido: lista os comandos registrados.
+ ----------------------------------------------------------------------------*/
+static void console_help(const char *args)
+{
+  (void)args;
+  for (uint i = 0; i < command_count; ++i)
+  {
+    printf("  %-10s %s\n", commands[i].name, commands[i].help);
+  }
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Inicializa o console e instala o aviso de chegada de caracteres.
+ *
+ *  @param[in] on_input : Chamada em contexto de IRQ quando há caracteres
+ *                        disponíveis; deve apenas acordar quem chama
+ *                        console_poll().
+ *  @param[in] param    : Parâmetro repassado a `on_input`.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void console_init(void (*on_input)(void *), void *param)
+{
+  console_register("help", "lista os comandos", console_help);
+  stdio_set_chars_available_callback(on_input, param);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Registra um comando.
+ *
+ *  @param[in] name : Primeiro token da linha que aciona o comando.
+ *  @param[in] help : Descrição exibida por "help".
+ *  @param[in] fn   : Handler do comando.
+ *
+ *  @return (bool) : false se não houver mais espaço.
+ *
+ ----------------------------------------------------------------------------*/
+bool console_register(const char *name, const char *help, console_cmd_t fn)
+{
+  if (fn == NULL || command_count >= CONSOLE_MAX_COMMANDS)
+  {
+    return false;
+  }
+  commands[command_count].name = name;
+  commands[command_count].help = help;
+  commands[command_count].fn = fn;
+  ++command_count;
+  return true;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Executa uma linha completa.
+ ----------------------------------------------------------------------------*/
+static void console_execute(char *text)
+{
+  while (*text == ' ')
+  {
+    ++text;
+  }
+  if (*text == '\0')
+  {
+    return;
+  }
+
+  char *args = text;
+  while (*args != '\0' && *args != ' ')
+  {
+    ++args;
+  }
+  if (*args != '\0')
+  {
+    *args++ = '\0';
+    while (*args == ' ')
+    {
+      ++args;
+    }
+  }
+
+  for (uint i = 0; i < command_count; ++i)
+  {
+    if (strcmp(commands[i].name, text) == 0)
+    {
+      commands[i].fn(args);
+      return;
+    }
+  }
+  printf("comando desconhecido: %s (use help)\n", text);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Consome os caracteres disponíveis sem bloquear.
+ *  Cada '\r' ou '\n' encerra uma linha; linhas longas demais são descartadas
+ *  inteiras.
+ *
+ *  @param[in] (void) : Não recebe parâmetros.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void console_poll(void)
+{
+  int c;
+
+  while ((c = getchar_timeout_us(0)) != PICO_ERROR_TIMEOUT)
+  {
+    if (c == '\r' || c == '\n')
+    {
+      line[line_len] = '\0';
+      if (line_overflow)
+      {
+        printf("linha longa demais\n");
+      }
+      else
+      {
+        console_execute(line);
+      }
+      line_len = 0;
+      line_overflow = false;
+    }
+    else if (line_len < CONSOLE_LINE_MAX - 1)
+    {
+      line[line_len++] = (char)c;
+    }
+    else
+    {
+      line_overflow = true;
+    }
+  }
+}
+/* end program */
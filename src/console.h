@@ -0,0 +1,42 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Console de comandos por linha sobre o stdio (USB/UART).
+ *            A chegada de caracteres é sinalizada por um callback de IRQ;
+ *            quem recebe o sinal (despachante ou tarefa) chama
+ *            console_poll(), que lê sem bloquear e executa cada linha
+ *            completa pelo primeiro token.
+ *
+ *  @file	    console.h
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#include <stdbool.h>
+
+/* =============================   MACROS   ================================ */
+
+#define CONSOLE_MAX_COMMANDS 8  // Comandos registrados
+#define CONSOLE_LINE_MAX     64 // Maior linha aceita (o excesso é descartado)
+
+/* =============================   TYPES   ================================= */
+
+/*!
+ *  @brief Handler de comando; `args` aponta para o restante da linha (sem
+ *         espaços iniciais, possivelmente vazio).
+ */
+typedef void (*console_cmd_t)(const char *args);
+
+/* ========================   FUNCTION PROTOTYPE   ========================= */
+
+void console_init(void (*on_input)(void *), void *param);
+bool console_register(const char *name, const char *help, console_cmd_t fn);
+void console_poll(void);
+
+#endif /* CONSOLE_H */
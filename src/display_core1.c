@@ -0,0 +1,256 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Motor de desenho e flush do display executado no core 1.
+ *
+ *  @file	    display_core1.c
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+/* ============================   LIBRARIES  =============================== */
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/sync.h"
+
+#include "display_core1.h"
+#include "hot_path.h"
+#include "metrics.h"
+
+/* =============================   TYPES   ================================= */
+
+typedef enum {
+  DCMD_CLEAR,
+  DCMD_PIXEL,
+  DCMD_LINE,
+  DCMD_SQUARE,
+  DCMD_EMPTY_SQUARE,
+  DCMD_STRING,
+  DCMD_TEXT,
+  DCMD_SHOW,
+} display_op_t;
+
+// Comando de desenho: 32 bytes, copiado por valor para o anel. O ponteiro
+// da fonte vem primeiro para ficar alinhado sem preenchimento.
+typedef struct {
+  union {
+    struct {
+      int16_t c, d;                 // largura, altura (ou x2, y2 da linha)
+    };
+    const ssd1306_font_t *font;     // Fonte proporcional (DCMD_TEXT)
+  };
+  int16_t a, b;    // x, y (ou x1, y1 da linha)
+  uint8_t op;      // display_op_t
+  uint8_t scale;   // Escala (DCMD_STRING) ou alinhamento (DCMD_TEXT)
+  char text[DISPLAY_TEXT_MAX];
+} display_cmd_t;
+
+/* =========================   GLOBAL VARIABLES   ========================== */
+
+// Anel SPSC: `head` só é escrito pelo core 0 (produtor) e `tail` só pelo
+// core 1 (consumidor). Os índices crescem livremente e são mascarados no uso.
+static display_cmd_t ring[DISPLAY_RING_SIZE];
+static volatile uint32_t ring_head = 0;
+static volatile uint32_t ring_tail = 0;
+
+static ssd1306_t *target = NULL;         // Display controlado pelo core 1
+static volatile display_core1_stats_t stats; // Estatísticas do motor
+
+/* ========================   FUNCTION PROTOTYPE   ========================= */
+
+static void display_core1_main(void);
+
+/* =======================  DEVELOPMENT OF FUNCTIONS ======================= */
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Lança o motor de display no core 1.
+ *  O display já deve estar inicializado; a partir desta chamada ele passa a
+ *  pertencer exclusivamente ao core 1 e não deve mais ser acessado pelo core 0.
+ *
+ *  @param[in] p : Display inicializado por ssd1306_init().
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void display_core1_start(ssd1306_t *p)
+{
+  target = p;
+  metrics_handoff(); // As métricas do I2C e dos quadros passam a ser escritas pelo core 1
+  multicore_launch_core1(display_core1_main);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Enfileira um comando (core 0, produtor único).
+ *  Nunca bloqueia: se o anel estiver cheio o comando é descartado e contado.
+ *  A campainha só é tocada se a FIFO tiver espaço; se estiver cheia, o core 1
+ *  já tem campainhas pendentes e vai esvaziar o anel de qualquer forma.
+ *
+ *  @return (bool) : false se o comando foi descartado.
+ *
+ ----------------------------------------------------------------------------*/
+static bool HOT_FUNC(display_core1_post)(const display_cmd_t *cmd)
+{
+  uint32_t head = ring_head;
+
+  if (head - ring_tail >= DISPLAY_RING_SIZE)
+  {
+    ++stats.dropped;
+    return false;
+  }
+
+  ring[head & (DISPLAY_RING_SIZE - 1)] = *cmd;
+  __dmb(); // O conteúdo do comando deve ser visível antes do novo head
+  ring_head = head + 1;
+
+  if (multicore_fifo_wready())
+  {
+    multicore_fifo_push_blocking(head);
+  }
+  return true;
+}
+
+bool display_core1_clear(void)
+{
+  display_cmd_t cmd = { .op = DCMD_CLEAR };
+  return display_core1_post(&cmd);
+}
+
+bool display_core1_draw_pixel(uint32_t x, uint32_t y)
+{
+  display_cmd_t cmd = { .op = DCMD_PIXEL, .a = x, .b = y };
+  return display_core1_post(&cmd);
+}
+
+bool display_core1_draw_line(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+  display_cmd_t cmd = { .op = DCMD_LINE, .a = x1, .b = y1, .c = x2, .d = y2 };
+  return display_core1_post(&cmd);
+}
+
+bool display_core1_draw_square(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+  display_cmd_t cmd = { .op = DCMD_SQUARE, .a = x, .b = y, .c = width, .d = height };
+  return display_core1_post(&cmd);
+}
+
+bool display_core1_draw_empty_square(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+  display_cmd_t cmd = { .op = DCMD_EMPTY_SQUARE, .a = x, .b = y, .c = width, .d = height };
+  return display_core1_post(&cmd);
+}
+
+bool display_core1_draw_string(uint32_t x, uint32_t y, uint32_t scale, const char *s)
+{
+  display_cmd_t cmd = { .op = DCMD_STRING, .scale = scale, .a = x, .b = y };
+  strncpy(cmd.text, s, sizeof(cmd.text) - 1); // Textos longos são truncados
+  return display_core1_post(&cmd);
+}
+
+bool display_core1_draw_text(uint32_t x, uint32_t y, const ssd1306_font_t *font,
+                             ssd1306_align_t align, const char *s)
+{
+  display_cmd_t cmd = { .op = DCMD_TEXT, .scale = align, .a = x, .b = y, .font = font };
+  strncpy(cmd.text, s, sizeof(cmd.text) - 1);
+  return display_core1_post(&cmd);
+}
+
+bool display_core1_show(void)
+{
+  display_cmd_t cmd = { .op = DCMD_SHOW };
+  return display_core1_post(&cmd);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Copia as estatísticas do motor (chamada pelo core 0).
+ *
+ *  @param[out] out : Destino da cópia.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void display_core1_get_stats(display_core1_stats_t *out)
+{
+  out->frames = stats.frames;
+  out->last_flush_us = stats.last_flush_us;
+  out->max_flush_us = stats.max_flush_us;
+  out->dropped = stats.dropped;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Executa um comando de desenho sobre o buffer do display (core 1).
+ ----------------------------------------------------------------------------*/
+static void HOT_FUNC(display_core1_execute)(const display_cmd_t *cmd)
+{
+  switch (cmd->op)
+  {
+  case DCMD_CLEAR:
+    ssd1306_clear(target);
+    break;
+  case DCMD_PIXEL:
+    ssd1306_draw_pixel(target, cmd->a, cmd->b);
+    break;
+  case DCMD_LINE:
+    ssd1306_draw_line(target, cmd->a, cmd->b, cmd->c, cmd->d);
+    break;
+  case DCMD_SQUARE:
+    ssd1306_draw_square(target, cmd->a, cmd->b, cmd->c, cmd->d);
+    break;
+  case DCMD_EMPTY_SQUARE:
+    ssd1306_draw_empty_square(target, cmd->a, cmd->b, cmd->c, cmd->d);
+    break;
+  case DCMD_STRING:
+    ssd1306_draw_string(target, cmd->a, cmd->b, cmd->scale, cmd->text);
+    break;
+  case DCMD_TEXT:
+    ssd1306_draw_text_aligned(target, cmd->a, cmd->b, cmd->font, cmd->scale, cmd->text);
+    break;
+  case DCMD_SHOW:
+  {
+    uint64_t start = time_us_64();
+    ssd1306_show(target);
+    uint32_t elapsed = (uint32_t)(time_us_64() - start);
+
+    stats.last_flush_us = elapsed;
+    if (elapsed > stats.max_flush_us)
+    {
+      stats.max_flush_us = elapsed;
+    }
+    ++stats.frames;
+    metrics_observe(HIST_DISPLAY_FLUSH_US, elapsed); // Atualizados só pelo core 1
+    metrics_inc(METRIC_DISPLAY_FRAMES);
+    break;
+  }
+  default:
+    break;
+  }
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Laço bare-metal do core 1.
+ *  Esvazia o anel executando cada comando e, quando não há mais nada, dorme
+ *  na FIFO entre cores até a próxima campainha. Como o anel é sempre
+ *  verificado depois de consumir uma campainha, nenhum comando fica perdido.
+ ----------------------------------------------------------------------------*/
+static void HOT_FUNC(display_core1_main)(void)
+{
+  while (true)
+  {
+    while (ring_tail != ring_head)
+    {
+      uint32_t tail = ring_tail;
+
+      __dmb(); // Lê o comando somente depois de observar o novo head
+      display_core1_execute(&ring[tail & (DISPLAY_RING_SIZE - 1)]);
+      __dmb(); // Termina de ler o comando antes de liberar a posição
+      ring_tail = tail + 1;
+    }
+
+    (void)multicore_fifo_pop_blocking(); // Aguarda a campainha do core 0
+  }
+}
+/* end program */
@@ -0,0 +1,57 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Motor de desenho e flush do display executado no core 1.
+ *            O core 0 (FreeRTOS) apenas enfileira comandos de desenho num
+ *            anel SPSC sem travas em SRAM compartilhada; a FIFO entre cores
+ *            é usada só como campainha. Toda a latência de renderização e de
+ *            I2C fica no core 1.
+ *
+ *  @file	    display_core1.h
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+#ifndef DISPLAY_CORE1_H
+#define DISPLAY_CORE1_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "ssd1306.h"
+
+/* =============================   MACROS   ================================ */
+
+#define DISPLAY_RING_SIZE 32 // Capacidade do anel de comandos (potência de 2)
+#define DISPLAY_TEXT_MAX  22 // Texto por comando de string, incluindo '\0'
+
+/* =============================   TYPES   ================================= */
+
+/*!
+ *  @brief Estatísticas do motor, escritas pelo core 1 e lidas pelo core 0.
+ */
+typedef struct {
+  uint32_t frames;        /**< quadros enviados ao display */
+  uint32_t last_flush_us; /**< duração do último ssd1306_show() */
+  uint32_t max_flush_us;  /**< maior duração de ssd1306_show() */
+  uint32_t dropped;       /**< comandos descartados por anel cheio */
+} display_core1_stats_t;
+
+/* ========================   FUNCTION PROTOTYPE   ========================= */
+
+void display_core1_start(ssd1306_t *p);
+bool display_core1_clear(void);
+bool display_core1_draw_pixel(uint32_t x, uint32_t y);
+bool display_core1_draw_line(int32_t x1, int32_t y1, int32_t x2, int32_t y2);
+bool display_core1_draw_square(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+bool display_core1_draw_empty_square(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+bool display_core1_draw_string(uint32_t x, uint32_t y, uint32_t scale, const char *s);
+bool display_core1_draw_text(uint32_t x, uint32_t y, const ssd1306_font_t *font,
+                             ssd1306_align_t align, const char *s);
+bool display_core1_show(void);
+void display_core1_get_stats(display_core1_stats_t *stats);
+
+#endif /* DISPLAY_CORE1_H */
@@ -0,0 +1,244 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Núcleo de despacho de eventos baseado em queue sets do FreeRTOS.
+ *
+ *  @file	    event_dispatch.c
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+/* ============================   LIBRARIES  =============================== */
+#include "event_dispatch.h"
+#include "hot_path.h"
+
+/* =============================   TYPES   ================================= */
+
+typedef struct {
+  QueueSetMemberHandle_t member; // Fila ou semáforo registrado
+  UBaseType_t length;            // Capacidade da fonte (contabilizada no queue set)
+  bool is_semaphore;             // true se a fonte é um semáforo
+  dispatch_handler_t handler;    // Função executada para cada evento
+  void *ctx;                     // Contexto repassado ao handler
+} dispatch_source_t;
+
+/* =========================   GLOBAL VARIABLES   ========================== */
+
+static dispatch_source_t sources[DISPATCH_MAX_SOURCES]; // Fontes registradas
+static UBaseType_t source_count = 0;                    // Quantidade de fontes
+static QueueSetHandle_t queue_set = NULL;               // Criado em dispatch_start()
+static void (*start_hook)(void) = NULL;                 // Executado no início da tarefa
+
+/* ========================   FUNCTION PROTOTYPE   ========================= */
+
+static void dispatch_release_set(QueueSetHandle_t set, UBaseType_t count);
+static void dispatch_task(void *pvParameters);
+
+/* =======================  DEVELOPMENT OF FUNCTIONS ======================= */
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Registra uma fonte de eventos na tabela do despachante.
+ *
+ *  @return (bool) : false se a tabela estiver cheia ou o despachante já iniciado.
+ *
+ ----------------------------------------------------------------------------*/
+static bool dispatch_add_source(QueueSetMemberHandle_t member, UBaseType_t length, bool is_semaphore,
+                                dispatch_handler_t handler, void *ctx)
+{
+  // Membros só podem ser adicionados ao queue set enquanto estão vazios,
+  // então todo o registro acontece antes de dispatch_start().
+  if (member == NULL || queue_set != NULL || source_count >= DISPATCH_MAX_SOURCES)
+  {
+    return false;
+  }
+
+  sources[source_count].member = member;
+  sources[source_count].length = length;
+  sources[source_count].is_semaphore = is_semaphore;
+  sources[source_count].handler = handler;
+  sources[source_count].ctx = ctx;
+  ++source_count;
+  return true;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Cria uma fila de eventos atendida pelo despachante.
+ *
+ *  @param[in] length    : Quantidade máxima de itens pendentes.
+ *  @param[in] item_size : Tamanho de cada item (até DISPATCH_MAX_ITEM_SIZE).
+ *  @param[in] handler   : Função executada para cada item recebido.
+ *  @param[in] ctx       : Contexto repassado ao handler.
+ *
+ *  @return (QueueHandle_t) : Fila para os produtores, ou NULL em caso de erro.
+ *
+ ----------------------------------------------------------------------------*/
+QueueHandle_t dispatch_create_queue(UBaseType_t length, UBaseType_t item_size, dispatch_handler_t handler, void *ctx)
+{
+  if (item_size > DISPATCH_MAX_ITEM_SIZE)
+  {
+    return NULL;
+  }
+
+  QueueHandle_t queue = xQueueCreate(length, item_size);
+  if (queue != NULL && !dispatch_add_source(queue, length, false, handler, ctx))
+  {
+    vQueueDelete(queue);
+    queue = NULL;
+  }
+  return queue;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Cria um semáforo contador atendido pelo despachante.
+ *  O handler é executado uma vez para cada "give" no semáforo.
+ *
+ *  @param[in] max_count : Quantidade máxima de sinalizações pendentes.
+ *  @param[in] handler   : Função executada para cada sinalização.
+ *  @param[in] ctx       : Contexto repassado ao handler.
+ *
+ *  @return (SemaphoreHandle_t) : Semáforo para os produtores, ou NULL em caso de erro.
+ *
+ ----------------------------------------------------------------------------*/
+SemaphoreHandle_t dispatch_create_semaphore(UBaseType_t max_count, dispatch_handler_t handler, void *ctx)
+{
+  SemaphoreHandle_t sem = xSemaphoreCreateCounting(max_count, 0);
+  if (sem != NULL && !dispatch_add_source(sem, max_count, true, handler, ctx))
+  {
+    vSemaphoreDelete(sem);
+    sem = NULL;
+  }
+  return sem;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Cria o queue set com todas as fontes registradas e a tarefa
+ *  despachante. Depois desta chamada nenhuma fonte pode ser registrada.
+ *
+ *  @param[in]  name        : Nome da tarefa despachante.
+ *  @param[in]  stack_depth : Tamanho da pilha (em palavras).
+ *  @param[in]  priority    : Prioridade da tarefa.
+ *  @param[in]  on_start    : Executado pela tarefa antes do primeiro evento (pode ser NULL).
+ *  @param[out] handle      : Handle da tarefa criada (pode ser NULL).
+ *
+ *  @return (BaseType_t) : pdPASS em caso de sucesso; em caso de falha o queue
+ *                         set é desfeito e nenhum recurso fica alocado.
+ *
+ ----------------------------------------------------------------------------*/
+BaseType_t dispatch_start(const char *name, uint32_t stack_depth, UBaseType_t priority,
+                          void (*on_start)(void), TaskHandle_t *handle)
+{
+  UBaseType_t total_length = 0;
+
+  if (source_count == 0 || queue_set != NULL)
+  {
+    return pdFAIL;
+  }
+
+  // O queue set precisa comportar a soma das capacidades de todas as fontes
+  for (UBaseType_t i = 0; i < source_count; ++i)
+  {
+    total_length += sources[i].length;
+  }
+
+  QueueSetHandle_t set = xQueueCreateSet(total_length);
+  if (set == NULL)
+  {
+    return pdFAIL;
+  }
+
+  UBaseType_t added = 0;
+  while (added < source_count && xQueueAddToSet(sources[added].member, set) == pdPASS)
+  {
+    ++added;
+  }
+
+  if (added == source_count)
+  {
+    queue_set = set;
+    start_hook = on_start;
+    if (xTaskCreate(dispatch_task, name, stack_depth, NULL, priority, handle) == pdPASS)
+    {
+      return pdPASS;
+    }
+    queue_set = NULL;
+    start_hook = NULL;
+  }
+
+  // Desfaz o queue set para que as fontes voltem a ser filas comuns
+  dispatch_release_set(set, added);
+  return pdFAIL;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Retira do queue set as `count` primeiras fontes e o apaga.
+ *  As fontes continuam vazias (nada foi enviado antes do início), condição
+ *  exigida por xQueueRemoveFromSet().
+ *
+ *  @param[in] set   : Queue set criado em dispatch_start().
+ *  @param[in] count : Quantidade de fontes já adicionadas a ele.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+static void dispatch_release_set(QueueSetHandle_t set, UBaseType_t count)
+{
+  for (UBaseType_t i = 0; i < count; ++i)
+  {
+    xQueueRemoveFromSet(sources[i].member, set);
+  }
+  vQueueDelete(set);
+}
+
+/* ===========================  DEVELOPMENT TASKS ========================== */
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Tarefa despachante.
+ *  Bloqueia no queue set até que qualquer fonte tenha um evento, retira
+ *  exatamente um evento dessa fonte e executa o handler correspondente até o
+ *  fim (run-to-completion) antes de aguardar o próximo.
+ *
+ *  @param[in] pvParameters : Parâmetro genérico da tarefa, não utilizado nesta função.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+static void HOT_FUNC(dispatch_task)(void *pvParameters)
+{
+  // Cópia do item recebido; alinhada para ser acessada como qualquer struct
+  uint8_t item[DISPATCH_MAX_ITEM_SIZE] __attribute__((aligned(8)));
+
+  if (start_hook != NULL)
+  {
+    start_hook();
+  }
+
+  while (true)
+  {
+    QueueSetMemberHandle_t ready = xQueueSelectFromSet(queue_set, portMAX_DELAY);
+
+    for (UBaseType_t i = 0; i < source_count; ++i)
+    {
+      if (sources[i].member != ready)
+      {
+        continue;
+      }
+
+      if (sources[i].is_semaphore)
+      {
+        if (xSemaphoreTake(ready, 0) == pdTRUE)
+        {
+          sources[i].handler(NULL, sources[i].ctx);
+        }
+      }
+      else if (xQueueReceive(ready, item, 0) == pdTRUE)
+      {
+        sources[i].handler(item, sources[i].ctx);
+      }
+      break;
+    }
+  }
+}
+/* end program */
@@ -0,0 +1,47 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Núcleo de despacho de eventos baseado em queue sets do FreeRTOS.
+ *            Cada fonte de eventos (fila ou semáforo) é registrada com um
+ *            handler; uma única tarefa despachante bloqueia em todas as
+ *            fontes ao mesmo tempo e executa cada handler até o fim.
+ *
+ *  @file	    event_dispatch.h
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+#ifndef EVENT_DISPATCH_H
+#define EVENT_DISPATCH_H
+
+#include <stdbool.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+
+/* =============================   MACROS   ================================ */
+
+#define DISPATCH_MAX_SOURCES   8  // Número máximo de filas/semáforos registrados
+#define DISPATCH_MAX_ITEM_SIZE 32 // Tamanho máximo (bytes) de um item de fila
+
+/* =============================   TYPES   ================================= */
+
+/*!
+ *  @brief Handler de evento. Para filas, `item` aponta para uma cópia do item
+ *         recebido; para semáforos, `item` é NULL.
+ */
+typedef void (*dispatch_handler_t)(const void *item, void *ctx);
+
+/* ========================   FUNCTION PROTOTYPE   ========================= */
+
+QueueHandle_t dispatch_create_queue(UBaseType_t length, UBaseType_t item_size, dispatch_handler_t handler, void *ctx);
+SemaphoreHandle_t dispatch_create_semaphore(UBaseType_t max_count, dispatch_handler_t handler, void *ctx);
+BaseType_t dispatch_start(const char *name, uint32_t stack_depth, UBaseType_t priority,
+                          void (*on_start)(void), TaskHandle_t *handle);
+
+#endif /* EVENT_DISPATCH_H */
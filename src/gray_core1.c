@@ -0,0 +1,168 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Motor de níveis de cinza do display executado no core 1.
+ *
+ *  @file	    gray_core1.c
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+/* ============================   LIBRARIES  =============================== */
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/sync.h"
+
+#include "gray_core1.h"
+#include "hot_path.h"
+#include "metrics.h"
+
+/* =============================   MACROS   ================================ */
+
+#define GRAY_PLANE_BYTES 1024 // Maior buffer suportado (128x64, 1 bit por pixel)
+
+/* =========================   GLOBAL VARIABLES   ========================== */
+
+// Planos publicados pelo core 0 e lidos pelo core 1 ao montar cada quadro.
+// A trava cobre só a cópia e a montagem (microssegundos), nunca o envio.
+static uint32_t front_lo[GRAY_PLANE_BYTES / 4];
+static uint32_t front_hi[GRAY_PLANE_BYTES / 4];
+static spin_lock_t *lock = NULL;
+
+static ssd1306_t *target = NULL;     // Display controlado pelo core 1
+static uint32_t period_us = 0;       // Período de um quadro de plano
+static gray_core1_stats_t stats;     // Janela atual, protegida pela trava
+static uint64_t window_start_us = 0; // Início da janela atual
+
+/* ========================   FUNCTION PROTOTYPE   ========================= */
+
+static void gray_core1_main(void);
+
+/* =======================  DEVELOPMENT OF FUNCTIONS ======================= */
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Lança o motor de cinza no core 1 com os planos atuais de `g`.
+ *  O display já deve estar inicializado; a partir desta chamada ele passa a
+ *  pertencer exclusivamente ao core 1 e não deve mais ser acessado pelo core 0.
+ *
+ *  @param[in] g        : Buffer de cinza do display (ssd1306_gray_init()).
+ *  @param[in] plane_hz : Quadros de plano por segundo; um ciclo de cinza tem
+ *                        SSD1306_GRAY_PHASES quadros.
+ *
+ *  @return (bool) : false se o buffer do display não cabe nos planos do motor.
+ *
+ ----------------------------------------------------------------------------*/
+bool gray_core1_start(ssd1306_gray_t *g, uint32_t plane_hz)
+{
+  if (g->disp->bufsize > GRAY_PLANE_BYTES || plane_hz == 0)
+  {
+    return false;
+  }
+
+  target = g->disp;
+  period_us = 1000000u / plane_hz;
+  lock = spin_lock_instance(spin_lock_claim_unused(true));
+  memcpy(front_lo, g->lo, target->bufsize);
+  memcpy(front_hi, g->hi, target->bufsize);
+  window_start_us = time_us_64();
+  metrics_handoff(); // As métricas do I2C passam a ser escritas pelo core 1
+  multicore_launch_core1(gray_core1_main);
+  return true;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Publica os planos de `g` para o motor (core 0).
+ *  Um quadro de plano montado durante a cópia espera o fim dela, então o
+ *  core 1 nunca mistura dois quadros do core 0 no mesmo plano.
+ *
+ *  @param[in] g : Buffer de cinza com o quadro terminado.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void HOT_FUNC(gray_core1_publish)(const ssd1306_gray_t *g)
+{
+  uint32_t save = spin_lock_blocking(lock);
+  memcpy(front_lo, g->lo, target->bufsize);
+  memcpy(front_hi, g->hi, target->bufsize);
+  spin_unlock(lock, save);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Copia as estatísticas da janela atual e inicia uma nova.
+ *
+ *  @param[out] out : Destino da cópia.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void gray_core1_get_stats(gray_core1_stats_t *out)
+{
+  uint32_t save = spin_lock_blocking(lock);
+  uint64_t now = time_us_64();
+
+  *out = stats;
+  out->window_us = (uint32_t)(now - window_start_us);
+  stats = (gray_core1_stats_t){ 0 };
+  window_start_us = now;
+  spin_unlock(lock, save);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Laço bare-metal do core 1.
+ *  Monta o próximo quadro do ciclo a partir dos planos publicados, envia as
+ *  páginas que mudaram e espera o próximo prazo. Um plano que estoura o
+ *  período é contado e o relógio é realinhado, para não enviar uma rajada
+ *  de planos atrasados (o que desbalancearia os níveis de cinza).
+ ----------------------------------------------------------------------------*/
+static void HOT_FUNC(gray_core1_main)(void)
+{
+  uint32_t phase = 0;
+  absolute_time_t next = get_absolute_time();
+
+  while (true)
+  {
+    uint32_t start = time_us_32();
+    uint32_t save = spin_lock_blocking(lock);
+    uint32_t pages = ssd1306_gray_build(target, (const uint8_t *)front_lo,
+                                        (const uint8_t *)front_hi, phase);
+    spin_unlock(lock, save);
+    uint32_t built = time_us_32();
+    ssd1306_gray_send(target, pages);
+    uint32_t end = time_us_32();
+
+    next = delayed_by_us(next, period_us);
+    bool late = absolute_time_diff_us(get_absolute_time(), next) < 0;
+
+    save = spin_lock_blocking(lock);
+    ++stats.planes;
+    stats.pages += __builtin_popcount(pages);
+    stats.late += late;
+    stats.busy_us += end - start;
+    if (built - start > stats.build_max_us)
+    {
+      stats.build_max_us = built - start;
+    }
+    if (end - built > stats.send_max_us)
+    {
+      stats.send_max_us = end - built;
+    }
+    spin_unlock(lock, save);
+
+    phase = (phase + 1 < SSD1306_GRAY_PHASES) ? phase + 1 : 0;
+    if (late)
+    {
+      next = get_absolute_time();
+    }
+    else
+    {
+      busy_wait_until(next);
+    }
+  }
+}
+/* end program */
@@ -0,0 +1,48 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Motor de níveis de cinza do display executado no core 1.
+ *            O core 1 envia os quadros de plano de um ciclo de cinza
+ *            (ssd1306_gray.h) a uma taxa fixa, a partir de uma cópia dos
+ *            planos que o core 0 publica quando termina um quadro. Como o
+ *            flush contínuo ocupa o I2C quase o tempo todo, ele fica
+ *            inteiro no core 1 e o core 0 só paga a cópia dos planos.
+ *
+ *  @file	    gray_core1.h
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+#ifndef GRAY_CORE1_H
+#define GRAY_CORE1_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "ssd1306_gray.h"
+
+/* =============================   TYPES   ================================= */
+
+/*!
+ *  @brief Estatísticas do motor na janela desde a última leitura.
+ */
+typedef struct {
+  uint32_t planes;       /**< quadros de plano montados */
+  uint32_t pages;        /**< páginas enviadas (só as que mudaram desde o plano anterior) */
+  uint32_t late;         /**< planos que não couberam no período */
+  uint32_t build_max_us; /**< maior montagem de um plano */
+  uint32_t send_max_us;  /**< maior envio de um plano */
+  uint32_t busy_us;      /**< tempo do core 1 montando e enviando planos */
+  uint32_t window_us;    /**< duração da janela medida */
+} gray_core1_stats_t;
+
+/* ========================   FUNCTION PROTOTYPE   ========================= */
+
+bool gray_core1_start(ssd1306_gray_t *g, uint32_t plane_hz);
+void gray_core1_publish(const ssd1306_gray_t *g);
+void gray_core1_get_stats(gray_core1_stats_t *out);
+
+#endif /* GRAY_CORE1_H */
@@ -0,0 +1,28 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Posicionamento do caminho crítico da aplicação.
+ *            Com HOT_PATH_IN_SRAM (opção CMake) as funções marcadas com
+ *            HOT_FUNC() são ligadas em SRAM, fora do alcance das falhas do
+ *            cache XIP de 16 KB. Sem a opção, continuam executando da flash.
+ *
+ *  @file	    hot_path.h
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+#ifndef HOT_PATH_H
+#define HOT_PATH_H
+
+#include "pico/stdlib.h"
+
+#if HOT_PATH_IN_SRAM
+#define HOT_FUNC(func) __not_in_flash_func(func)
+#else
+#define HOT_FUNC(func) func
+#endif
+
+#endif /* HOT_PATH_H */
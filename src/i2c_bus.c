@@ -0,0 +1,319 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Gerenciador de barramento I2C compartilhado.
+ *
+ *  @file	    i2c_bus.c
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+/* ============================   LIBRARIES  =============================== */
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "i2c_bus.h"
+#include "ssd1306.h"
+#include "hot_path.h"
+
+/* =======================  DEVELOPMENT OF FUNCTIONS ======================= */
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Escolhe a próxima transação: a do nível mais urgente que já está
+ *  em curso ou que tem algo na fila. Uma transação que começa enquanto uma
+ *  escrita fatiada de nível menor está pela metade conta como preempção.
+ ----------------------------------------------------------------------------*/
+static i2c_bus_txn_t *HOT_FUNC(i2c_bus_next)(i2c_bus_t *bus)
+{
+  for (uint32_t level = 0; level < I2C_BUS_PRIORITIES; ++level)
+  {
+    if (bus->active[level] == NULL &&
+        xQueueReceive(bus->queue[level], &bus->active[level], 0) == pdTRUE)
+    {
+      bus->active[level]->start_us = time_us_32();
+      for (uint32_t lower = level + 1; lower < I2C_BUS_PRIORITIES; ++lower)
+      {
+        if (bus->active[lower] != NULL)
+        {
+          ++bus->stats.preemptions;
+          break;
+        }
+      }
+    }
+    if (bus->active[level] != NULL)
+    {
+      return bus->active[level];
+    }
+  }
+  return NULL;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Encerra a transação: contabiliza o cliente e o libera.
+ ----------------------------------------------------------------------------*/
+static void i2c_bus_finish(i2c_bus_t *bus, i2c_bus_txn_t *txn, int result)
+{
+  uint32_t now = time_us_32();
+  uint32_t latency = now - txn->submit_us;
+  uint32_t wait = txn->start_us - txn->submit_us;
+  i2c_bus_client_stats_t *s = &txn->client->stats;
+
+  txn->result = result;
+  bus->active[txn->priority] = NULL;
+  ++bus->stats.transactions;
+
+  taskENTER_CRITICAL();
+  ++s->transactions;
+  if (result < 0)
+  {
+    ++s->errors;
+  }
+  else
+  {
+    s->bytes += (uint32_t)result;
+  }
+  s->latency_sum_us += latency;
+  if (latency > s->latency_max_us)
+  {
+    s->latency_max_us = latency;
+  }
+  if (wait > s->wait_max_us)
+  {
+    s->wait_max_us = wait;
+  }
+  taskEXIT_CRITICAL();
+
+  xSemaphoreGive(txn->client->done);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Envia a próxima fatia da transação (ou a transação inteira).
+ *  A primeira fatia sai direto de tx, que já começa pelo prefixo; as
+ *  seguintes são copiadas para chunk_buf atrás de uma cópia do prefixo.
+ *  Cada escrita tem o prazo do driver do display, e um timeout recupera o
+ *  barramento antes de devolver o erro ao cliente.
+ *
+ *  @param[in] bus : Barramento.
+ *  @param[in] txn : Transação escolhida por i2c_bus_next().
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+static void HOT_FUNC(i2c_bus_step)(i2c_bus_t *bus, i2c_bus_txn_t *txn)
+{
+  const uint8_t *src = txn->tx;
+  size_t len = txn->tx_len;
+
+  if (txn->chunk != 0)
+  {
+    if (txn->sent == 0)
+    {
+      len = (len > 1u + txn->chunk) ? 1u + txn->chunk : len;
+    }
+    else
+    {
+      size_t n = txn->tx_len - txn->sent;
+      n = (n > txn->chunk) ? txn->chunk : n;
+      bus->chunk_buf[0] = txn->tx[0];
+      memcpy(&bus->chunk_buf[1], txn->tx + txn->sent, n);
+      src = bus->chunk_buf;
+      len = n + 1;
+    }
+  }
+  bool read = txn->chunk == 0 && txn->rx_len != 0;
+
+  uint32_t start = time_us_32();
+  int result = i2c_write_timeout_us(bus->i2c, txn->address, src, len, read, ssd1306_write_timeout_us(len));
+  if (read && result == (int)len)
+  {
+    result = i2c_read_timeout_us(bus->i2c, txn->address, txn->rx, txn->rx_len, false,
+                                 ssd1306_write_timeout_us(txn->rx_len));
+  }
+  bus->stats.busy_us += time_us_32() - start;
+  ++bus->stats.writes;
+
+  if (result == PICO_ERROR_TIMEOUT)
+  {
+    ssd1306_bus_recover(bus->i2c);
+  }
+  if (result < 0)
+  {
+    i2c_bus_finish(bus, txn, result);
+    return;
+  }
+
+  txn->sent += (src == txn->tx) ? len : len - 1;
+  if (txn->sent >= txn->tx_len)
+  {
+    i2c_bus_finish(bus, txn, (int)(txn->tx_len + (read ? txn->rx_len : 0)));
+  }
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Tarefa dona do controlador: envia uma fatia por vez, sempre da
+ *  transação mais urgente, e dorme quando não há nada a fazer. Cada entrega
+ *  acorda a tarefa por notificação.
+ ----------------------------------------------------------------------------*/
+static void i2c_bus_task(void *pvParameters)
+{
+  i2c_bus_t *bus = pvParameters;
+
+  for (;;)
+  {
+    i2c_bus_txn_t *txn = i2c_bus_next(bus);
+    if (txn == NULL)
+    {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+    i2c_bus_step(bus, txn);
+  }
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Cria as filas e a tarefa que passa a ser dona do controlador. O
+ *  controlador já deve estar inicializado; a partir daqui só a tarefa do
+ *  gerenciador acessa o I2C.
+ *
+ *  @param[out] bus         : Estado do barramento (deve existir enquanto a tarefa rodar).
+ *  @param[in]  i2c         : Controlador gerenciado.
+ *  @param[in]  name        : Nome da tarefa.
+ *  @param[in]  stack_words : Pilha da tarefa.
+ *  @param[in]  priority    : Prioridade da tarefa (acima dos clientes).
+ *
+ *  @return (bool) : false se as filas ou a tarefa não puderam ser criadas.
+ *
+ ----------------------------------------------------------------------------*/
+bool i2c_bus_start(i2c_bus_t *bus, i2c_inst_t *i2c, const char *name, uint32_t stack_words, UBaseType_t priority)
+{
+  memset(bus, 0, sizeof(*bus));
+  bus->i2c = i2c;
+
+  for (uint32_t level = 0; level < I2C_BUS_PRIORITIES; ++level)
+  {
+    bus->queue[level] = xQueueCreate(I2C_BUS_QUEUE_LENGTH, sizeof(i2c_bus_txn_t *));
+    if (bus->queue[level] == NULL)
+    {
+      return false;
+    }
+  }
+
+  bus->window_start_us = time_us_64();
+  return xTaskCreate(i2c_bus_task, name, stack_words, bus, priority, &bus->task) == pdPASS;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Prepara um cliente do barramento.
+ *
+ *  @param[out] client : Cliente a inicializar.
+ *  @param[in]  name   : Nome usado no relatório.
+ *
+ *  @return (bool) : false se o semáforo não pôde ser criado.
+ *
+ ----------------------------------------------------------------------------*/
+bool i2c_bus_client_init(i2c_bus_client_t *client, const char *name)
+{
+  client->name = name;
+  client->stats = (i2c_bus_client_stats_t){ 0 };
+  client->done = xSemaphoreCreateBinary();
+  return client->done != NULL;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Entrega uma transação e bloqueia até que ela termine. Só pode ser
+ *  chamada de tarefas, depois do início do escalonador.
+ *
+ *  @param[in]     bus : Barramento.
+ *  @param[in,out] txn : Transação preenchida pelo cliente; result na volta.
+ *
+ *  @return (int) : Bytes transferidos, ou PICO_ERROR_GENERIC (NACK) /
+ *                  PICO_ERROR_TIMEOUT.
+ *
+ ----------------------------------------------------------------------------*/
+int HOT_FUNC(i2c_bus_transfer)(i2c_bus_t *bus, i2c_bus_txn_t *txn)
+{
+  if (txn->priority >= I2C_BUS_PRIORITIES)
+  {
+    txn->priority = I2C_BUS_PRIO_LOW;
+  }
+  if (txn->chunk > I2C_BUS_CHUNK_MAX)
+  {
+    txn->chunk = I2C_BUS_CHUNK_MAX;
+  }
+  txn->sent = 0;
+  txn->result = 0;
+  txn->submit_us = time_us_32();
+
+  xQueueSend(bus->queue[txn->priority], &txn, portMAX_DELAY);
+  xTaskNotifyGive(bus->task);
+  xSemaphoreTake(txn->client->done, portMAX_DELAY);
+  return txn->result;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Escrita simples, sem fatias.
+ ----------------------------------------------------------------------------*/
+int i2c_bus_write(i2c_bus_t *bus, i2c_bus_client_t *client, uint8_t address, uint8_t priority,
+                  const uint8_t *src, size_t len)
+{
+  i2c_bus_txn_t txn = {
+    .client = client, .address = address, .priority = priority, .tx = src, .tx_len = len
+  };
+  return i2c_bus_transfer(bus, &txn);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Escrita seguida de leitura com START repetido (leitura de registrador).
+ ----------------------------------------------------------------------------*/
+int i2c_bus_write_read(i2c_bus_t *bus, i2c_bus_client_t *client, uint8_t address, uint8_t priority,
+                       const uint8_t *src, size_t len, uint8_t *dst, size_t dst_len)
+{
+  i2c_bus_txn_t txn = {
+    .client = client, .address = address, .priority = priority,
+    .tx = src, .tx_len = len, .rx = dst, .rx_len = dst_len
+  };
+  return i2c_bus_transfer(bus, &txn);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Copia as estatísticas do barramento e inicia uma nova janela.
+ *
+ *  @param[in]  bus : Barramento.
+ *  @param[out] out : Destino da cópia.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void i2c_bus_get_stats(i2c_bus_t *bus, i2c_bus_stats_t *out)
+{
+  uint64_t now = time_us_64();
+
+  taskENTER_CRITICAL();
+  *out = bus->stats;
+  out->window_us = (uint32_t)(now - bus->window_start_us);
+  bus->stats = (i2c_bus_stats_t){ 0 };
+  bus->window_start_us = now;
+  taskEXIT_CRITICAL();
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Copia as estatísticas de um cliente e inicia uma nova janela.
+ *
+ *  @param[in]  client : Cliente.
+ *  @param[out] out    : Destino da cópia.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void i2c_bus_client_get_stats(i2c_bus_client_t *client, i2c_bus_client_stats_t *out)
+{
+  taskENTER_CRITICAL();
+  *out = client->stats;
+  client->stats = (i2c_bus_client_stats_t){ 0 };
+  taskEXIT_CRITICAL();
+}
+/* end program */
@@ -0,0 +1,132 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Gerenciador de barramento I2C compartilhado.
+ *            Uma tarefa por controlador é dona do barramento e executa as
+ *            transações que as demais tarefas entregam por uma fila com
+ *            níveis de prioridade. Escritas longas (o quadro do display)
+ *            são enviadas em fatias; entre uma fatia e outra o gerenciador
+ *            olha de novo as filas, de modo que uma transação curta e mais
+ *            prioritária espera no máximo uma fatia, e não o quadro inteiro.
+ *
+ *  @file	    i2c_bus.h
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "hardware/i2c.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+
+/* =============================   MACROS   ================================ */
+
+#define I2C_BUS_QUEUE_LENGTH 4   // Transações pendentes por nível de prioridade
+#define I2C_BUS_CHUNK_MAX    128 // Maior fatia de uma escrita longa (sem o byte de prefixo)
+
+/* =============================   TYPES   ================================= */
+
+/*!
+ *  @brief Níveis de prioridade das transações (menor valor = mais urgente).
+ */
+typedef enum {
+  I2C_BUS_PRIO_HIGH,   /**< transações curtas e sensíveis à latência */
+  I2C_BUS_PRIO_NORMAL, /**< leituras periódicas de sensores */
+  I2C_BUS_PRIO_LOW,    /**< escritas longas, como o quadro do display */
+  I2C_BUS_PRIORITIES
+} i2c_bus_priority_t;
+
+/*!
+ *  @brief Estatísticas de um cliente desde a última leitura.
+ */
+typedef struct {
+  uint32_t transactions;   /**< transações concluídas */
+  uint32_t errors;         /**< transações terminadas com NACK ou timeout */
+  uint32_t bytes;          /**< bytes escritos e lidos */
+  uint64_t latency_sum_us; /**< soma das latências (entrega -> fim) */
+  uint32_t latency_max_us; /**< maior latência */
+  uint32_t wait_max_us;    /**< maior espera na fila (entrega -> início) */
+} i2c_bus_client_stats_t;
+
+/*!
+ *  @brief Cliente do barramento: uma tarefa (ou um driver) que entrega
+ *         transações. Cada cliente tem no máximo uma transação em curso.
+ */
+typedef struct {
+  const char *name;             /**< nome usado no relatório */
+  SemaphoreHandle_t done;       /**< liberado pelo gerenciador ao fim da transação */
+  i2c_bus_client_stats_t stats; /**< acumulado da janela atual */
+} i2c_bus_client_t;
+
+/*!
+ *  @brief Descritor de uma transação: escrita de tx e, opcionalmente,
+ *         leitura de rx após um START repetido.
+ *
+ *  Com chunk > 0 a escrita é enviada em fatias de até chunk bytes de dados;
+ *  tx[0] é um byte de prefixo (o byte de controle do SSD1306) repetido no
+ *  início de cada fatia. Transações fatiadas não fazem leitura.
+ */
+typedef struct {
+  i2c_bus_client_t *client; /**< quem entregou a transação */
+  uint8_t address;          /**< endereço de 7 bits do alvo */
+  uint8_t priority;         /**< i2c_bus_priority_t */
+  uint16_t chunk;           /**< bytes de dados por fatia, 0: escrita inteira */
+  const uint8_t *tx;        /**< bytes a escrever */
+  size_t tx_len;            /**< tamanho de tx */
+  uint8_t *rx;              /**< destino da leitura, ou NULL */
+  size_t rx_len;            /**< bytes a ler */
+  int result;               /**< bytes transferidos, ou PICO_ERROR_GENERIC / PICO_ERROR_TIMEOUT */
+  size_t sent;              /**< uso interno: bytes de tx já enviados */
+  uint32_t submit_us;       /**< uso interno: instante da entrega */
+  uint32_t start_us;        /**< uso interno: instante da primeira fatia */
+} i2c_bus_txn_t;
+
+/*!
+ *  @brief Estatísticas de um barramento desde a última leitura.
+ */
+typedef struct {
+  uint32_t transactions; /**< transações concluídas */
+  uint32_t writes;       /**< transações I2C no fio (uma por fatia) */
+  uint32_t preemptions;  /**< transações atendidas no meio de uma escrita fatiada */
+  uint32_t busy_us;      /**< tempo com o barramento ocupado */
+  uint32_t window_us;    /**< duração da janela medida */
+} i2c_bus_stats_t;
+
+/*!
+ *  @brief Estado de um controlador I2C sob o gerenciador.
+ */
+typedef struct {
+  i2c_inst_t *i2c;                                /**< controlador gerenciado */
+  TaskHandle_t task;                              /**< tarefa dona do controlador */
+  QueueHandle_t queue[I2C_BUS_PRIORITIES];        /**< transações pendentes, por nível */
+  i2c_bus_txn_t *active[I2C_BUS_PRIORITIES];      /**< transação em curso em cada nível */
+  uint8_t chunk_buf[1 + I2C_BUS_CHUNK_MAX];       /**< prefixo + dados da fatia atual */
+  i2c_bus_stats_t stats;                          /**< acumulado da janela atual */
+  uint64_t window_start_us;                       /**< início da janela atual */
+} i2c_bus_t;
+
+/* ========================   FUNCTION PROTOTYPE   ========================= */
+
+bool i2c_bus_start(i2c_bus_t *bus, i2c_inst_t *i2c, const char *name, uint32_t stack_words, UBaseType_t priority);
+bool i2c_bus_client_init(i2c_bus_client_t *client, const char *name);
+int i2c_bus_transfer(i2c_bus_t *bus, i2c_bus_txn_t *txn);
+int i2c_bus_write(i2c_bus_t *bus, i2c_bus_client_t *client, uint8_t address, uint8_t priority,
+                  const uint8_t *src, size_t len);
+int i2c_bus_write_read(i2c_bus_t *bus, i2c_bus_client_t *client, uint8_t address, uint8_t priority,
+                       const uint8_t *src, size_t len, uint8_t *dst, size_t dst_len);
+void i2c_bus_get_stats(i2c_bus_t *bus, i2c_bus_stats_t *out);
+void i2c_bus_client_get_stats(i2c_bus_client_t *client, i2c_bus_client_stats_t *out);
+
+#endif /* I2C_BUS_H */
@@ -0,0 +1,136 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Varredura e debouncing paralelo de todas as entradas digitais.
+ *
+ *  @file	    input_scan.c
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+/* ============================   LIBRARIES  =============================== */
+#include "pico/stdlib.h"
+#include "hardware/gpio.h"
+
+#include "input_scan.h"
+#include "hot_path.h"
+
+/* =======================  DEVELOPMENT OF FUNCTIONS ======================= */
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Inicializa os pinos de entrada e o estado do scanner.
+ *  Configura todos os pinos de `mask` como entrada (com pull-up nos pinos
+ *  ativos em nível baixo) e carrega o estado inicial a partir de uma leitura
+ *  real, evitando eventos espúrios logo após o boot.
+ *
+ *  @param[out] s          : Instância do scanner.
+ *  @param[in]  mask       : Máscara de GPIOs monitorados (bit n = GPIO n).
+ *  @param[in]  active_low : Subconjunto de `mask` acionado em nível baixo.
+ *  @param[in]  long_ticks : Varreduras contínuas até o long-press (0 desabilita).
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void input_scan_init(input_scan_t *s, uint32_t mask, uint32_t active_low, uint32_t long_ticks)
+{
+  gpio_init_mask(mask);
+  gpio_set_dir_in_masked(mask);
+
+  for (uint pin = 0; pin < 32; ++pin)
+  {
+    if (active_low & mask & (1u << pin))
+    {
+      gpio_pull_up(pin);
+    }
+  }
+
+  s->mask = mask;
+  s->active_low = active_low & mask;
+  s->cnt0 = ~0u; // Contadores começam em 3 (nenhuma mudança pendente)
+  s->cnt1 = ~0u;
+  for (uint k = 0; k < INPUT_SCAN_HOLD_BITS; ++k)
+  {
+    s->hold[k] = 0;
+  }
+  s->long_fired = 0;
+  s->long_ticks = (long_ticks < (1u << INPUT_SCAN_HOLD_BITS)) ? long_ticks : (1u << INPUT_SCAN_HOLD_BITS) - 1;
+
+  sleep_us(10); // Aguarda os pull-ups estabilizarem antes da primeira leitura
+  s->state = (gpio_get_all() ^ s->active_low) & s->mask;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Processa uma amostra bruta de todos os GPIOs.
+ *  O debouncing usa dois contadores verticais de 2 bits: cada pino cujo nível
+ *  difere do estado filtrado decrementa seu contador e, após 4 amostras
+ *  consecutivas diferentes, o estado é invertido. Um segundo contador vertical
+ *  mede o tempo de acionamento para gerar o long-press. Todas as operações são
+ *  bit a bit sobre palavras de 32 bits, então o custo independe do número de
+ *  pinos.
+ *
+ *  @param[in,out] s   : Instância do scanner.
+ *  @param[in]     raw : Leitura bruta, no formato de gpio_get_all().
+ *  @param[out]    ev  : Eventos gerados nesta amostra.
+ *
+ *  @return (bool) : true se algum evento foi gerado.
+ *
+ ----------------------------------------------------------------------------*/
+bool HOT_FUNC(input_scan_feed)(input_scan_t *s, uint32_t raw, input_events_t *ev)
+{
+  uint32_t sample = (raw ^ s->active_low) & s->mask; // 1 = acionado
+  uint32_t changed = s->state ^ sample;
+
+  // Contador vertical de 2 bits: reinicia em 3 quando não há mudança e
+  // decrementa enquanto a amostra diferir do estado filtrado.
+  s->cnt0 = ~(s->cnt0 & changed);
+  s->cnt1 = s->cnt0 ^ (s->cnt1 & changed);
+  changed &= s->cnt0 & s->cnt1; // Bits cujo contador deu a volta
+
+  s->state ^= changed;
+  ev->pressed = changed & s->state;
+  ev->released = changed & ~s->state;
+
+  // Zera o contador de tempo dos pinos liberados e o incrementa (com carry
+  // propagado entre os planos) nos pinos acionados que ainda não dispararam.
+  uint32_t carry = s->state & ~s->long_fired;
+  for (uint k = 0; k < INPUT_SCAN_HOLD_BITS; ++k)
+  {
+    uint32_t next = s->hold[k] & carry;
+    s->hold[k] = (s->hold[k] ^ carry) & s->state;
+    carry = next;
+  }
+  s->long_fired &= s->state;
+
+  ev->long_pressed = 0;
+  if (s->long_ticks != 0)
+  {
+    // Compara todos os contadores com o limiar de uma vez, plano a plano
+    uint32_t equal = s->state & ~s->long_fired;
+    for (uint k = 0; k < INPUT_SCAN_HOLD_BITS; ++k)
+    {
+      equal &= (s->long_ticks & (1u << k)) ? s->hold[k] : ~s->hold[k];
+    }
+    ev->long_pressed = equal;
+    s->long_fired |= equal;
+  }
+
+  return (ev->pressed | ev->released | ev->long_pressed) != 0;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Amostra todos os GPIOs numa única leitura e processa a amostra.
+ *
+ *  @param[in,out] s  : Instância do scanner.
+ *  @param[out]    ev : Eventos gerados nesta varredura.
+ *
+ *  @return (bool) : true se algum evento foi gerado.
+ *
+ ----------------------------------------------------------------------------*/
+bool HOT_FUNC(input_scan_update)(input_scan_t *s, input_events_t *ev)
+{
+  return input_scan_feed(s, gpio_get_all(), ev);
+}
+/* end program */
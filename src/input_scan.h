@@ -0,0 +1,61 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Varredura e debouncing paralelo de todas as entradas digitais.
+ *            Todos os pinos configurados são amostrados numa única leitura
+ *            de gpio_get_all() e filtrados por contadores verticais (um bit
+ *            por pino em cada palavra), de modo que o custo por varredura
+ *            não depende da quantidade de botões.
+ *
+ *  @file	    input_scan.h
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+#ifndef INPUT_SCAN_H
+#define INPUT_SCAN_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* =============================   MACROS   ================================ */
+
+// Número de planos do contador vertical de tempo pressionado (long-press).
+// O limiar de long-press, em varreduras, deve ser menor que 2^INPUT_SCAN_HOLD_BITS.
+#define INPUT_SCAN_HOLD_BITS 8
+
+/* =============================   TYPES   ================================= */
+
+/*!
+ *  @brief Estado do scanner. Cada palavra de 32 bits guarda um bit por GPIO.
+ */
+typedef struct {
+  uint32_t mask;        /**< pinos monitorados */
+  uint32_t active_low;  /**< pinos acionados em nível baixo (pull-up) */
+  uint32_t state;       /**< estado filtrado (1 = acionado) */
+  uint32_t cnt0;        /**< bit 0 do contador vertical de debouncing */
+  uint32_t cnt1;        /**< bit 1 do contador vertical de debouncing */
+  uint32_t hold[INPUT_SCAN_HOLD_BITS]; /**< contador vertical de tempo acionado */
+  uint32_t long_fired;  /**< pinos cujo long-press já foi reportado */
+  uint32_t long_ticks;  /**< limiar de long-press, em varreduras (0 desabilita) */
+} input_scan_t;
+
+/*!
+ *  @brief Eventos gerados por uma varredura, como máscaras de bits por GPIO.
+ */
+typedef struct {
+  uint32_t pressed;      /**< pinos que acabaram de ser acionados */
+  uint32_t released;     /**< pinos que acabaram de ser liberados */
+  uint32_t long_pressed; /**< pinos que atingiram o limiar de long-press */
+} input_events_t;
+
+/* ========================   FUNCTION PROTOTYPE   ========================= */
+
+void input_scan_init(input_scan_t *s, uint32_t mask, uint32_t active_low, uint32_t long_ticks);
+bool input_scan_feed(input_scan_t *s, uint32_t raw, input_events_t *ev);
+bool input_scan_update(input_scan_t *s, input_events_t *ev);
+
+#endif /* INPUT_SCAN_H */
@@ -0,0 +1,233 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Camada de port do LVGL (v9) sobre o driver SSD1306.
+ *
+ *  @file	    lvgl_port.c
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+/* ============================   LIBRARIES  =============================== */
+#include <stdio.h>
+
+#include "pico/stdlib.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+#include "lvgl_port.h"
+#include "hot_path.h"
+#include "metrics.h"
+
+/* =============================   MACROS   ================================ */
+
+#define LVGL_PORT_PALETTE_BYTES 8 // Paleta de 2 cores que o LVGL põe antes dos pixels I1
+
+/* =========================   GLOBAL VARIABLES   ========================== */
+
+static ssd1306_t *target = NULL;      // Display controlado pelo port
+static lv_display_t *lv_disp = NULL;  // Display correspondente no LVGL
+static TaskHandle_t lvgl_task = NULL; // Tarefa que conduz o LVGL
+static SemaphoreHandle_t lvgl_mutex = NULL;
+
+// Buffer parcial: LVGL_PORT_BUF_ROWS linhas de 1 bpp mais a paleta
+// (128 colunas x 16 linhas = 256 + 8 bytes)
+static uint8_t draw_buf[LVGL_PORT_PALETTE_BYTES + (128 / 8) * LVGL_PORT_BUF_ROWS] __attribute__((aligned(4)));
+
+static lvgl_port_stats_t stats;    // Acumulado da janela atual
+static uint64_t window_start_us;   // Início da janela atual
+
+/* =======================  DEVELOPMENT OF FUNCTIONS ======================= */
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Fonte do tick do LVGL, em ms, derivada do tick do FreeRTOS.
+ ----------------------------------------------------------------------------*/
+static uint32_t lvgl_port_tick(void)
+{
+  return (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Arredonda cada área invalidada para blocos de 8x8: linhas
+ *  inteiras de páginas e colunas múltiplas de 8, para que a conversão seja
+ *  só transposições de blocos alinhados.
+ ----------------------------------------------------------------------------*/
+static void lvgl_port_rounder(lv_event_t *e)
+{
+  lv_area_t *area = lv_event_get_param(e);
+
+  area->x1 &= ~7;
+  area->x2 |= 7;
+  area->y1 &= ~7;
+  area->y2 |= 7;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Callback de flush: converte a área renderizada (linhas de bits,
+ *  bit 7 à esquerda) para páginas do SSD1306 no buffer do driver e envia
+ *  apenas a janela correspondente.
+ *
+ *  @param[in] disp   : Display do LVGL.
+ *  @param[in] area   : Área renderizada (alinhada pelo lvgl_port_rounder).
+ *  @param[in] px_map : Paleta seguida dos pixels da área.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+static void HOT_FUNC(lvgl_port_flush)(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+  int32_t width = lv_area_get_width(area);
+  uint32_t stride = lv_draw_buf_width_to_stride(width, LV_COLOR_FORMAT_I1);
+  uint32_t start = time_us_32();
+
+  px_map += LVGL_PORT_PALETTE_BYTES;
+  for (int32_t y = area->y1; y <= area->y2; y += 8)
+  {
+    const uint8_t *row = px_map + (y - area->y1) * stride;
+    uint8_t *dst = target->buffer + (y >> 3) * target->width + area->x1;
+
+    // Bloco de 8 colunas: bit 7 do byte da linha b é a coluna 0 -> ordem invertida
+    for (int32_t block = 0; block < width / 8; ++block)
+    {
+      ssd1306_transpose8(row + block, stride, dst + block * 8 + 7, -1);
+    }
+  }
+
+  ssd1306_show_area(target, area->x1, area->x2, area->y1 >> 3, area->y2 >> 3);
+
+  metrics_observe(HIST_DISPLAY_FLUSH_US, time_us_32() - start);
+  ++stats.areas;
+  stats.bytes += (uint32_t)width * (uint32_t)lv_area_get_height(area) / 8;
+  if (lv_display_flush_is_last(disp))
+  {
+    ++stats.frames;
+    metrics_inc(METRIC_DISPLAY_FRAMES);
+  }
+  lv_display_flush_ready(disp);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Inicializa o LVGL e registra o display. Deve ser chamada antes do
+ *  escalonador, depois de ssd1306_init(); a partir daqui o display pertence
+ *  ao port.
+ *
+ *  @param[in] p : Display já inicializado (largura e altura múltiplas de 8).
+ *
+ *  @return (lv_display_t *) : Display do LVGL, ou NULL em caso de falha.
+ *
+ ----------------------------------------------------------------------------*/
+lv_display_t *lvgl_port_init(ssd1306_t *p)
+{
+  if (p->width > 128 || (p->width & 7) || (p->height & 7))
+  {
+    return NULL;
+  }
+
+  lvgl_mutex = xSemaphoreCreateMutex();
+  if (lvgl_mutex == NULL)
+  {
+    return NULL;
+  }
+
+  target = p;
+  lv_init();
+  lv_tick_set_cb(lvgl_port_tick);
+
+  lv_disp = lv_display_create(p->width, p->height);
+  lv_display_set_color_format(lv_disp, LV_COLOR_FORMAT_I1);
+  lv_display_set_buffers(lv_disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+  lv_display_set_flush_cb(lv_disp, lvgl_port_flush);
+  lv_display_add_event_cb(lv_disp, lvgl_port_rounder, LV_EVENT_INVALIDATE_AREA, NULL);
+
+  lv_obj_t *screen = lv_screen_active();
+  lv_obj_set_style_bg_color(screen, lv_color_black(), 0);
+  lv_obj_set_style_text_color(screen, lv_color_white(), 0);
+
+  window_start_us = time_us_64();
+  return lv_disp;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Tarefa do LVGL: executa lv_timer_handler() sob o mutex e dorme
+ *  até o próximo timer do LVGL ou até um lvgl_port_refresh().
+ ----------------------------------------------------------------------------*/
+static void lvgl_port_task(void *pvParameters)
+{
+  for (;;)
+  {
+    xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+    uint64_t start = time_us_64();
+    uint32_t wait_ms = lv_timer_handler();
+    stats.busy_us += (uint32_t)(time_us_64() - start);
+    xSemaphoreGive(lvgl_mutex);
+
+    if (wait_ms > LVGL_PORT_MAX_SLEEP_MS) // Inclui LV_NO_TIMER_READY
+    {
+      wait_ms = LVGL_PORT_MAX_SLEEP_MS;
+    }
+    TickType_t ticks = pdMS_TO_TICKS(wait_ms);
+    ulTaskNotifyTake(pdTRUE, ticks ? ticks : 1);
+  }
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Cria a tarefa que conduz o LVGL.
+ *
+ *  @param[in] priority    : Prioridade da tarefa.
+ *  @param[in] stack_words : Pilha da tarefa (a renderização usa a pilha).
+ *
+ *  @return (bool) : false se a tarefa não pôde ser criada.
+ *
+ ----------------------------------------------------------------------------*/
+bool lvgl_port_start(UBaseType_t priority, uint32_t stack_words)
+{
+  return xTaskCreate(lvgl_port_task, "LVGL_Task", stack_words, NULL, priority, &lvgl_task) == pdPASS;
+}
+
+void lvgl_port_lock(void)
+{
+  xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+}
+
+void lvgl_port_unlock(void)
+{
+  xSemaphoreGive(lvgl_mutex);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Acorda a tarefa do LVGL para renderizar já o que foi invalidado,
+ *  sem esperar o período de refresh.
+ ----------------------------------------------------------------------------*/
+void lvgl_port_refresh(void)
+{
+  if (lvgl_task != NULL)
+  {
+    xTaskNotifyGive(lvgl_task);
+  }
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Copia as estatísticas da janela atual e inicia uma nova.
+ *
+ *  @param[out] out : Destino da cópia.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void lvgl_port_get_stats(lvgl_port_stats_t *out)
+{
+  uint64_t now = time_us_64();
+
+  lvgl_port_lock();
+  *out = stats;
+  out->window_us = (uint32_t)(now - window_start_us);
+  stats = (lvgl_port_stats_t){ 0 };
+  window_start_us = now;
+  lvgl_port_unlock();
+}
+/* end program */
@@ -0,0 +1,59 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Camada de port do LVGL (v9) sobre o driver SSD1306.
+ *            O LVGL renderiza em 1 bpp (LV_COLOR_FORMAT_I1, linhas de bits)
+ *            num buffer parcial pequeno; o callback de flush converte cada
+ *            área para o formato de páginas do SSD1306 com a transposição
+ *            8x8 da biblioteca e envia só aquela janela de colunas/páginas.
+ *            O tick e o lv_timer_handler() são conduzidos por uma tarefa
+ *            do FreeRTOS; as demais tarefas acessam objetos do LVGL apenas
+ *            entre lvgl_port_lock() e lvgl_port_unlock().
+ *
+ *  @file	    lvgl_port.h
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+#ifndef LVGL_PORT_H
+#define LVGL_PORT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "FreeRTOS.h"
+
+#include "lvgl.h"
+#include "ssd1306.h"
+
+/* =============================   MACROS   ================================ */
+
+#define LVGL_PORT_BUF_ROWS     16  // Linhas do buffer parcial (múltiplo de 8)
+#define LVGL_PORT_MAX_SLEEP_MS 100 // Maior espera da tarefa entre chamadas ao LVGL
+
+/* =============================   TYPES   ================================= */
+
+/*!
+ *  @brief Estatísticas do port desde a última leitura.
+ */
+typedef struct {
+  uint32_t frames;    /**< quadros concluídos (último flush de um refresh) */
+  uint32_t areas;     /**< áreas enviadas ao display */
+  uint32_t bytes;     /**< bytes de pixel enviados por I2C */
+  uint32_t busy_us;   /**< tempo dentro de lv_timer_handler() (inclui flush) */
+  uint32_t window_us; /**< duração da janela medida */
+} lvgl_port_stats_t;
+
+/* ========================   FUNCTION PROTOTYPE   ========================= */
+
+lv_display_t *lvgl_port_init(ssd1306_t *p);
+bool lvgl_port_start(UBaseType_t priority, uint32_t stack_words);
+void lvgl_port_lock(void);
+void lvgl_port_unlock(void);
+void lvgl_port_refresh(void);
+void lvgl_port_get_stats(lvgl_port_stats_t *out);
+
+#endif /* LVGL_PORT_H */
@@ -14,6 +14,7 @@
 ============================================================================ */
 /* ============================   LIBRARIES  =============================== */
 #include <stdio.h>
+#include <string.h>
 #include "pico/stdlib.h"
 #include "hardware/gpio.h"
 #include "hardware/pwm.h"
@@ -21,50 +22,352 @@
 
 #include "FreeRTOS.h"
 #include "task.h"
+#include "queue.h"
+#include "semphr.h"
 
 #include "ssd1306.h"
+#if OLED_DUAL
+#include "ssd1306_dma.h"
+#endif
+#include "input_scan.h"
+#include "event_dispatch.h"
+#include "run_control.h"
+#include "wcet.h"
+#include "sys_status.h"
+#include "metrics.h"
+#include "console.h"
+#include "hot_path.h"
+#if OLED_ON_CORE1
+#include "display_core1.h"
+#endif
+#if APP_CLOCK_SCALING
+#include "hardware/uart.h"
+#include "clock_scale.h"
+#endif
+#if APP_LVGL
+#include "lvgl_port.h"
+#endif
+#if I2C_BUS_MANAGER
+#include "i2c_bus.h"
+#endif
+#if OLED_LAYERS
+#include "ssd1306_layer.h"
+#endif
+#if OLED_GRAYSCALE
+#include "gray_core1.h"
+#endif
 /* =============================   MACROS   ================================ */
 
+// --- Arquitetura da aplicação ---
+#ifndef APP_USE_DISPATCHER
+#define APP_USE_DISPATCHER 1 // 1: despachante único com queue set; 0: uma tarefa por funcionalidade
+#endif
+#define APP_TASK_STACK_WORDS 256  // Pilha de cada tarefa no modo uma-tarefa-por-funcionalidade
+#define DISPATCH_STACK_WORDS 512  // Pilha da única tarefa no modo despachante
+#define APP_TICK_PERIOD_MS 100    // Período do tick da aplicação no modo despachante
+#define APP_STATS_PERIOD_MS 10000 // Intervalo entre relatórios de RAM e trocas de contexto
+#define APP_TASK_PRIORITY 1       // Prioridade das tarefas de LED, buzzer, OLED e do despachante
+#define BUTTON_TASK_PRIORITY 2    // Prioridade maior para a varredura dos botões
+#ifndef OLED_ON_CORE1
+#define OLED_ON_CORE1 0 // 1: desenho e flush do OLED no core 1 (bare-metal)
+#endif
+#ifndef HOT_PATH_IN_SRAM
+#define HOT_PATH_IN_SRAM 0 // 1: desenho, flush e laços críticos executam da SRAM
+#endif
+#ifndef APP_BENCH_FLASH_LOAD
+#define APP_BENCH_FLASH_LOAD 0 // 1: tarefa de fundo que força falhas no cache XIP
+#endif
+#ifndef APP_CLOCK_SCALING
+#define APP_CLOCK_SCALING 0 // 1: clk_sys em eco/normal/boost conforme a carga
+#endif
+// Governador de clock (APP_CLOCK_SCALING): carga = fração da janela gasta desenhando
+#define CLOCK_GOVERN_WINDOW_MS 1000 // Janela de medição da carga
+#define CLOCK_UP_PERMIL 250         // Carga acima disto (25%) numa janela sobe um nível
+#define CLOCK_DOWN_PERMIL 50        // Carga abaixo disto (5%) conta uma janela calma
+#define CLOCK_DOWN_WINDOWS 3        // Janelas calmas seguidas para descer um nível
+#if APP_CLOCK_SCALING && OLED_ON_CORE1
+#error "APP_CLOCK_SCALING exige que o I2C do display pertença ao core 0 (OLED_ON_CORE1=0)"
+#endif
+#ifndef APP_LVGL
+#define APP_LVGL 0 // 1: telas desenhadas por rótulos do LVGL (port em src/lvgl_port.c)
+#endif
+#if APP_LVGL && (OLED_ON_CORE1 || APP_CLOCK_SCALING)
+#error "APP_LVGL exige que o display pertença à tarefa do LVGL (OLED_ON_CORE1=0, APP_CLOCK_SCALING=0)"
+#endif
+#ifndef OLED_STRIP_MODE
+#define OLED_STRIP_MODE 0 // 1: buffer de uma página (128 B), quadro desenhado página a página
+#endif
+#if OLED_STRIP_MODE && (OLED_ON_CORE1 || APP_LVGL)
+#error "OLED_STRIP_MODE exige o desenho no core 0 pela biblioteca (OLED_ON_CORE1=0, APP_LVGL=0)"
+#endif
+#ifndef OLED_DUAL
+#define OLED_DUAL 0 // 1: segundo display no i2c0, os dois enviados juntos por DMA
+#endif
+#if OLED_DUAL && (OLED_ON_CORE1 || APP_LVGL || OLED_STRIP_MODE)
+#error "OLED_DUAL exige os dois buffers inteiros no core 0 (OLED_ON_CORE1=0, APP_LVGL=0, OLED_STRIP_MODE=0)"
+#endif
+#ifndef I2C_BUS_MANAGER
+#define I2C_BUS_MANAGER 0 // 1: o i2c1 pertence a uma tarefa que atende transações por prioridade
+#endif
+#if I2C_BUS_MANAGER && (OLED_ON_CORE1 || OLED_DUAL || APP_CLOCK_SCALING)
+#error "I2C_BUS_MANAGER exige que só a tarefa do gerenciador acesse o I2C (OLED_ON_CORE1=0, OLED_DUAL=0, APP_CLOCK_SCALING=0)"
+#endif
+#ifndef OLED_LAYERS
+#define OLED_LAYERS 0 // 1: tela base + camada de alerta, compostas por página no buffer do display
+#endif
+#if OLED_LAYERS && (!APP_USE_DISPATCHER || OLED_ON_CORE1 || APP_LVGL || OLED_STRIP_MODE || OLED_DUAL)
+#error "OLED_LAYERS exige o despachante e o buffer inteiro no core 0 (APP_USE_DISPATCHER=1, OLED_ON_CORE1=0, APP_LVGL=0, OLED_STRIP_MODE=0, OLED_DUAL=0)"
+#endif
+#define OLED_ALERT_MS 2000 // Tempo do alerta sobre a tela de status (OLED_LAYERS)
+#ifndef OLED_GRAYSCALE
+#define OLED_GRAYSCALE 0 // 1: 4 níveis de cinza, planos de 1 bit enviados pelo core 1 a taxa fixa
+#endif
+#if OLED_GRAYSCALE && (OLED_ON_CORE1 || APP_LVGL || OLED_STRIP_MODE || OLED_DUAL || I2C_BUS_MANAGER || APP_CLOCK_SCALING || OLED_LAYERS)
+#error "OLED_GRAYSCALE exige o core 1 e o i2c1 só para o motor de cinza (OLED_ON_CORE1=0, APP_LVGL=0, OLED_STRIP_MODE=0, OLED_DUAL=0, I2C_BUS_MANAGER=0, APP_CLOCK_SCALING=0, OLED_LAYERS=0)"
+#endif
+#ifndef OLED_GRAY_PLANE_HZ
+#define OLED_GRAY_PLANE_HZ 90 // Planos por segundo: ciclo de cinza de 3 planos a 30 Hz
+#endif
+#ifndef OLED_GRAY_I2C_FREQUENCY
+#define OLED_GRAY_I2C_FREQUENCY 1000000 // I2C do modo de cinza (Fast-mode Plus, 1 MHz)
+#endif
+#define I2C_BUS_TASK_PRIORITY (BUTTON_TASK_PRIORITY + 1) // Gerenciador acima de todos os clientes
+#define I2C_BUS_STACK_WORDS 256 // Pilha da tarefa do gerenciador
+#define OLED_BUS_CHUNK 128      // Fatia do quadro entre transações urgentes (uma página)
+#define LVGL_TASK_STACK_WORDS 1024 // A renderização do LVGL usa a pilha da tarefa
+#define OLED_LV_LABELS 6           // Rótulos reaproveitados pelas telas (um por oled_draw_*)
+
 #define LED_R_PIN 13 // LED VERMELHO RGB BTDL
 #define LED_G_PIN 11 // LED VERDE RGB BTDL
 #define LED_B_PIN 12 // LED AZUL RGB BTDL
 
 #define BUZZER_A_PIN 21       // BUZZER ESQUERDO BTD
 #define BUZZER_FREQUENCY 8000 // Frequência do Buzzer em Hz
+#define BUZZER_CLKDIV(sys_hz) ((float)(sys_hz) / (BUZZER_FREQUENCY * 4096)) // Divisor do PWM
+
+#define LED_STEP_MS 500     // Tempo de cada cor do LED RGB
+#define BUZZER_ON_MS 100    // Tempo do buzzer ligado em cada ciclo
+#define BUZZER_CYCLE_MS 1000 // Período do padrão sonoro do buzzer
+
+// --- Workers controlados por run_control (execução/pausa) ---
+#define LED_WORKER 0    // Sequência de cores do LED RGB
+#define BUZZER_WORKER 1 // Padrão sonoro do buzzer
 
 #define BUTTON_A_PIN 5 // Botão A BTDL
 #define BUTTON_B_PIN 6 // Botão B BTDL
 
+// --- Configurações da varredura de entradas ---
+#define INPUT_PINS_MASK ((1u << BUTTON_A_PIN) | (1u << BUTTON_B_PIN)) // GPIOs varridos
+#define INPUT_ACTIVE_LOW_MASK INPUT_PINS_MASK // Entradas com pull-up (ativas em nível baixo)
+#define INPUT_SCAN_PERIOD_MS 5    // Período de varredura (debouncing de 4 amostras = 20ms)
+#define BUTTON_LONG_PRESS_MS 1000 // Tempo acionado até gerar o evento de long-press
+
 // --- Configurações do Display OLED ---
 #define I2C_SDA_PIN 14   // Pino SDA para comunicação I2C com o OLED
 #define I2C_SCL_PIN 15   // Pino SCL para comunicação I2C com o OLED
 #define I2C_ADDRESS 0x3C // Endereço I2C do display OLED SSD1306
 #define I2C_FREQUENCY 400000 // Frequência da comunicação I2C em Hz (400kHz)
 #define I2C_PORT i2c1        // Instância do barramento I2C a ser utilizada (i2c1)
-#define OLED_WIDTH 128       // Largura do display OLED em pixels
-#define OLED_HEIGHT 64       // Altura do display OLED em pixels
+#ifndef OLED_PROFILE
+#define OLED_PROFILE ssd1306_profile_128x64 // Controlador e geometria do display (ssd1306.h)
+#endif
+#ifndef OLED_ROTATION
+#define OLED_ROTATION 0      // Rotação de montagem em graus (0, 90, 180 ou 270)
+#endif
+#if OLED_ROTATION % 90 != 0 || OLED_ROTATION < 0 || OLED_ROTATION > 270
+#error "OLED_ROTATION deve ser 0, 90, 180 ou 270"
+#endif
+#if OLED_STRIP_MODE && (OLED_ROTATION == 90 || OLED_ROTATION == 270)
+#error "OLED_STRIP_MODE não suporta 90/270 graus (a transposição precisa do quadro inteiro)"
+#endif
+
+// --- Segundo display (OLED_DUAL), no conector I2C0 ---
+#define I2C_AUX_SDA_PIN 0    // Pino SDA do segundo display
+#define I2C_AUX_SCL_PIN 1    // Pino SCL do segundo display
+#define I2C_AUX_ADDRESS 0x3C // Endereço do segundo display (outro barramento, mesmo endereço)
+#define I2C_AUX_PORT i2c0    // Controlador do segundo display
 
 // Instância da estrutura de controle do display OLED
 ssd1306_t display;
+#if OLED_DUAL
+ssd1306_t display_aux;         // Display de status no i2c0
+ssd1306_dma_t oled_panels[2];  // Canais de DMA dos dois displays, enviados juntos
+#endif
+#if I2C_BUS_MANAGER
+i2c_bus_t oled_bus;               // Gerenciador do i2c1, compartilhado com outros dispositivos
+i2c_bus_client_t oled_bus_client; // O display como cliente do gerenciador
+#endif
+#if OLED_LAYERS
+ssd1306_compositor_t oled_layers; // Tela base e camadas compostas no buffer do display
+ssd1306_layer_t oled_alert;       // Alerta temporário sobre a tela base
+#define OLED_CANVAS (&oled_layers.base) // As telas desenham na camada base
+#else
+#define OLED_CANVAS (&display)          // As telas desenham direto no buffer do display
+#endif
+#if OLED_GRAYSCALE
+ssd1306_gray_t oled_gray; // Níveis de cinza (2 bits por pixel) desenhados pelas telas
+#endif
+
+/* =============================   TYPES   ================================= */
+
+// Evento de leitura de tag RFID (UID de até 10 bytes, ISO 14443-A)
+typedef struct {
+  uint8_t uid[SYS_STATUS_UID_MAX];
+  uint8_t uid_len;
+} rfid_event_t;
+
+// Jobs medidos pela captura de WCET (ver app_wcet_setup)
+enum {
+#if APP_USE_DISPATCHER
+  WCET_INPUT,   // on_input_event
+  WCET_TICK,    // on_app_tick
+  WCET_RFID,    // on_rfid_event
+  WCET_DISPLAY, // on_display_request
+#else
+  WCET_LED,     // Uma troca de cor da led_task
+  WCET_BUZZER,  // Um acionamento (liga ou desliga) da buzzer_task
+  WCET_BUTTON,  // Uma varredura da button_task
+  WCET_OLED,    // Um redesenho da oled_task
+#endif
+};
+
+// Requisição de atualização do display
+typedef struct {
+  bool has_message;  // true se `message` deve substituir a última mensagem
+  char message[SYS_STATUS_MESSAGE_MAX]; // Linha de mensagem do display
+} display_request_t;
+
+// Tela do display: desenha o quadro inteiro com as funções oled_draw_*. No
+// modo em faixas é chamada uma vez por página, então deve desenhar sempre o
+// mesmo quadro a partir de `ctx`
+typedef void (*oled_screen_t)(const void *ctx);
+
+#if OLED_STRIP_MODE
+// Tela e contexto repassados por oled_render() a cada página
+typedef struct {
+  oled_screen_t screen;
+  const void *ctx;
+} oled_strip_call_t;
+#endif
+
+#if APP_LVGL
+// Rótulo do LVGL que substitui uma chamada oled_draw_* da tela; guarda o
+// último estado aplicado para só invalidar o que mudou
+typedef struct {
+  lv_obj_t *obj;
+  const lv_font_t *font;
+  int16_t x, y;
+  uint8_t align;
+  bool visible;
+} oled_label_t;
+#endif
 
 /* =========================   GLOBAL VARIABLES   ========================== */
 
+// Contador de trocas de contexto, incrementado por traceTASK_SWITCHED_IN()
+volatile uint32_t ulContextSwitchCount = 0;
+
+// --- Tempo gasto pelo core 0 em cada quadro do display ---
+static uint64_t oled_frame_start_us = 0; // Início do quadro atual (oled_clear)
+static uint32_t oled_frame_max_us = 0;   // Maior tempo de quadro no core 0
+static uint64_t oled_frame_sum_us = 0;   // Soma dos tempos (para a média)
+static uint32_t oled_render_max_us = 0;  // Maior tempo de desenho (sem o flush)
+static uint64_t oled_render_sum_us = 0;  // Soma dos tempos de desenho
+static uint64_t oled_render_sq_sum = 0;  // Soma dos quadrados (para a variância)
+static uint32_t oled_frame_count = 0;    // Quadros desde o último relatório
+#if OLED_STRIP_MODE
+static uint32_t oled_strip_draw_us = 0;  // Desenho do quadro atual, somado sobre as páginas
+#endif
+#if APP_CLOCK_SCALING
+static uint32_t clock_busy_us = 0; // Desenho na janela atual do governador de clock
+#endif
+#if OLED_GRAYSCALE
+static uint32_t oled_level = SSD1306_GRAY_LEVELS - 1; // Nível das próximas chamadas oled_draw_*
+#endif
+
+#if APP_LVGL
+static oled_label_t oled_labels[OLED_LV_LABELS]; // Rótulos na ordem das chamadas de desenho
+static uint oled_label_next = 0;                 // Próximo rótulo do quadro atual
+#endif
+
+#if APP_BENCH_FLASH_LOAD
+volatile uint32_t flash_load_sink = 0; // Impede que as leituras da carga sejam removidas
+#endif
+
 // --- Handles das Tarefas do FreeRTOS ---
 TaskHandle_t xLedTaskHandle = NULL;    // Handle para a tarefa do LED
 TaskHandle_t xBuzzerTaskHandle = NULL; // Handle para a tarefa do Buzzer
+TaskHandle_t xButtonTaskHandle = NULL; // Handle para a tarefa dos botões
 TaskHandle_t xOledTaskHandle = NULL;   // Handle para a tarefa do OLED
+TaskHandle_t xDispatchTaskHandle = NULL; // Handle para a tarefa despachante
+TaskHandle_t xConsoleTaskHandle = NULL;  // Handle para a tarefa do console
+
+#if APP_USE_DISPATCHER
+// --- Fontes de eventos do despachante ---
+QueueHandle_t xInputQueue = NULL;       // Eventos de entrada (input_events_t)
+SemaphoreHandle_t xTickSemaphore = NULL; // Tick periódico da aplicação
+QueueHandle_t xRfidQueue = NULL;        // Tags lidas (rfid_event_t)
+QueueHandle_t xDisplayQueue = NULL;     // Requisições de desenho (display_request_t)
+SemaphoreHandle_t xConsoleSemaphore = NULL; // Caracteres disponíveis no console
+
+input_scan_t input_scanner;           // Debouncing das entradas (atualizado na ISR)
+repeating_timer_t input_scan_timer;   // Timer de hardware da varredura de entradas
+repeating_timer_t app_tick_timer;     // Timer de hardware do tick da aplicação
+#endif
 
 /* ========================   FUNCTION PROTOTYPE   ========================= */
 
 void buzzer_pwm_init(void);
 void SSD1306_Init(void);
+void app_report_stats(void);
+void app_publish_run_state(void);
+void app_print_status(void);
+void app_console_setup(void (*on_input)(void *), void *param);
+void cmd_metrics(const char *args);
+void cmd_status(const char *args);
+void oled_clear(void);
+void oled_draw_string(uint32_t x, uint32_t y, uint32_t scale, const char *s);
+void oled_draw_text(uint32_t x, uint32_t y, const ssd1306_font_t *font, ssd1306_align_t align, const char *s);
+void oled_set_level(uint32_t level);
+void oled_show(void);
+void oled_render(oled_screen_t screen, const void *ctx);
+void oled_screen_error(const void *ctx);
+void led_park(void *arg);
+void buzzer_park(void *arg);
+void app_wcet_setup(void);
+#if APP_CLOCK_SCALING
+void app_clock_setup(void);
+void app_clock_retime(clock_scale_phase_t phase, uint32_t sys_hz, void *ctx);
+clock_level_t app_clock_idle_level(void);
+void app_clock_govern(void);
+#endif
+#if APP_BENCH_FLASH_LOAD
+void flash_load_task(void *pvParameters);
+#endif
+#if I2C_BUS_MANAGER
+void app_i2c_bus_setup(void);
+int oled_bus_transport(void *ctx, uint8_t address, const uint8_t *src, size_t len);
+#endif
 
 /* ====================   TASKS FREERTOS PROTOTYPE   ======================= */
 
+#if APP_USE_DISPATCHER
+void app_dispatch_start(void);
+void on_input_event(const void *item, void *ctx);
+void on_app_tick(const void *item, void *ctx);
+void on_rfid_event(const void *item, void *ctx);
+void on_display_request(const void *item, void *ctx);
+void oled_screen_status(const void *ctx);
+void on_console_input(const void *item, void *ctx);
+#else
 void led_task(void *pvParameters);
 void buzzer_task(void *pvParameters);
 void button_task(void *pvParameters);
 void oled_task(void *pvParameters);
+void oled_screen_tasks(const void *ctx);
+void console_task(void *pvParameters);
+#endif
+void on_run_state_change(uint id, bool running, void *ctx);
 
 /* ===========================   MAIN FUNCTION   =========================== */
 int main(void)
@@ -75,30 +378,96 @@ int main(void)
 
   SSD1306_Init();     // Configura I2C e inicializa o display OLED
   buzzer_pwm_init();  // Configura o PWM para o buzzer
+#if APP_CLOCK_SCALING
+  app_clock_setup();  // A partir daqui PWM, I2C e UART acompanham o clk_sys
+#endif
+#if I2C_BUS_MANAGER
+  app_i2c_bus_setup(); // A partir daqui o i2c1 pertence à tarefa do gerenciador
+#endif
+#if OLED_ON_CORE1
+  display_core1_start(&display); // A partir daqui o display pertence ao core 1
+#endif
+#if OLED_GRAYSCALE
+  // A partir daqui o display pertence ao motor de cinza no core 1
+  if (!gray_core1_start(&oled_gray, OLED_GRAY_PLANE_HZ))
+  {
+    printf("Falha ao iniciar o motor de cinza!\n");
+    while(1);
+  }
+#endif
+#if APP_LVGL
+  // A partir daqui o display pertence à tarefa do LVGL
+  if (lvgl_port_init(&display) == NULL ||
+      !lvgl_port_start(APP_TASK_PRIORITY, LVGL_TASK_STACK_WORDS))
+  {
+    printf("Falha ao iniciar o LVGL!\n");
+    while(1);
+  }
+#endif
 
   printf("Hardware inicializado.\n");
 
+  // Workers começam em execução; pausa/retomada via bits do event group
+  if (!run_control_init())
+  {
+    printf("Erro ao criar o event group de controle!\n");
+    while(1);
+  }
+  app_publish_run_state(); // Primeiro retrato do sistema, antes de qualquer leitor
+
+#if APP_USE_DISPATCHER
+  // Uma única tarefa atende entradas, tick, RFID e display por meio de um queue set
+  input_scan_init(&input_scanner, INPUT_PINS_MASK, INPUT_ACTIVE_LOW_MASK,
+                  BUTTON_LONG_PRESS_MS / INPUT_SCAN_PERIOD_MS);
+
+  xInputQueue = dispatch_create_queue(8, sizeof(input_events_t), on_input_event, NULL);
+  xTickSemaphore = dispatch_create_semaphore(4, on_app_tick, NULL);
+  xRfidQueue = dispatch_create_queue(4, sizeof(rfid_event_t), on_rfid_event, NULL);
+  xDisplayQueue = dispatch_create_queue(4, sizeof(display_request_t), on_display_request, NULL);
+  xConsoleSemaphore = dispatch_create_semaphore(1, on_console_input, NULL);
+
+  BaseType_t dispatchStatus = dispatch_start("Dispatch_Task", DISPATCH_STACK_WORDS, APP_TASK_PRIORITY,
+                                             app_dispatch_start, &xDispatchTaskHandle);
+  run_control_subscribe(on_run_state_change, NULL); // Redesenha o display a cada transição
+
+  if (xInputQueue == NULL || xTickSemaphore == NULL || xRfidQueue == NULL || xDisplayQueue == NULL ||
+      xConsoleSemaphore == NULL || dispatchStatus != pdPASS)
+#else
   // Criação das tarefas do FreeRTOS
   // xTaskCreate(função_tarefa, nome_tarefa, tamanho_pilha, parametros_tarefa, prioridade, &handle_tarefa)
-  BaseType_t ledStatus = xTaskCreate(led_task, "LED_Task", 256, NULL, 1, &xLedTaskHandle);
-  BaseType_t buzzerStatus = xTaskCreate(buzzer_task, "Buzzer_Task", 256, NULL, 1, &xBuzzerTaskHandle);
-  BaseType_t buttonStatus = xTaskCreate(button_task, "Button_Task", 256, NULL, 2, NULL); // Prioridade maior para botões
-  BaseType_t oledStatus = xTaskCreate(oled_task, "OLED_Task", 256, NULL, 1, &xOledTaskHandle);
+  BaseType_t ledStatus = xTaskCreate(led_task, "LED_Task", APP_TASK_STACK_WORDS, NULL, APP_TASK_PRIORITY, &xLedTaskHandle);
+  BaseType_t buzzerStatus = xTaskCreate(buzzer_task, "Buzzer_Task", APP_TASK_STACK_WORDS, NULL, APP_TASK_PRIORITY, &xBuzzerTaskHandle);
+  BaseType_t buttonStatus = xTaskCreate(button_task, "Button_Task", APP_TASK_STACK_WORDS, NULL, BUTTON_TASK_PRIORITY, &xButtonTaskHandle);
+  BaseType_t oledStatus = xTaskCreate(oled_task, "OLED_Task", APP_TASK_STACK_WORDS, NULL, APP_TASK_PRIORITY, &xOledTaskHandle);
+  BaseType_t consoleStatus = xTaskCreate(console_task, "Console_Task", APP_TASK_STACK_WORDS, NULL, APP_TASK_PRIORITY, &xConsoleTaskHandle);
+
+  run_control_attach(LED_WORKER, xLedTaskHandle);       // Pausa interrompe as esperas do LED
+  run_control_attach(BUZZER_WORKER, xBuzzerTaskHandle); // e do buzzer
+  run_control_subscribe(on_run_state_change, NULL);     // Acorda a tarefa OLED a cada transição
 
   // Verifica se todas as tarefas foram criadas com sucesso
-  if (ledStatus != pdPASS || buzzerStatus != pdPASS || buttonStatus != pdPASS || oledStatus != pdPASS) 
+  if (ledStatus != pdPASS || buzzerStatus != pdPASS || buttonStatus != pdPASS || oledStatus != pdPASS ||
+      consoleStatus != pdPASS) 
+#endif
   {
     printf("Erro ao criar uma ou mais tarefas!\n");
     // Exibe mensagem de erro no OLED se a inicialização falhar
-    ssd1306_clear(&display);
-    ssd1306_draw_string(&display, 0, 0, 1, "Erro Task!");
-    ssd1306_show(&display);
+    oled_render(oled_screen_error, NULL);
     while(1); // Trava o sistema em caso de erro na criação de tarefas
   } 
   else 
   {
     printf("Tarefas criadas com sucesso.\n");
   }
+
+#if APP_BENCH_FLASH_LOAD
+  // Carga de fundo que percorre a flash e expulsa o conteúdo do cache XIP
+  xTaskCreate(flash_load_task, "Flash_Load", configMINIMAL_STACK_SIZE, NULL, APP_TASK_PRIORITY, NULL);
+#endif
+
+#if APP_WCET
+  app_wcet_setup(); // Relógios de CPU e descrição dos jobs para a análise de escalonabilidade
+#endif
   
   printf("Iniciando scheduler do FreeRTOS...\n");
   vTaskStartScheduler(); // Inicia o escalonador do FreeRTOS
@@ -131,12 +500,40 @@ void buzzer_pwm_init(void)
 
     pwm_config config = pwm_get_default_config();
     // Calcula o divisor de clock para atingir a frequência desejada do buzzer.
-    pwm_config_set_clkdiv(&config, clock_get_hz(clk_sys) / (BUZZER_FREQUENCY * 4096));
+    pwm_config_set_clkdiv(&config, BUZZER_CLKDIV(clock_get_hz(clk_sys)));
     pwm_init(slice_num, &config, true); // Inicializa o slice PWM e o habilita
 
     pwm_set_gpio_level(BUZZER_A_PIN, 0); // Inicia o PWM com o buzzer desligado
 }
 
+/*! ---------------------------------------------------------------------------
+ *  @brief Tela de boas-vindas, desenhada direto pela biblioteca antes das
+ *  métricas do display existirem.
+ ----------------------------------------------------------------------------*/
+static void oled_draw_boot(ssd1306_t *p, void *ctx)
+{
+  ssd1306_draw_string(p, 0, 0, 1, "Inicialização..."); // Texto em UTF-8
+}
+
+#if OLED_DUAL
+/*! ---------------------------------------------------------------------------
+ *  @brief Tela do segundo display: contador de tags e tempo ligado. Lê o
+ *  próprio retrato do sistema, pois é desenhada a cada quadro do principal.
+ ----------------------------------------------------------------------------*/
+static void oled_draw_aux(ssd1306_t *p, void *ctx)
+{
+  sys_status_t snap;
+  char line[25];
+
+  sys_status_read(&snap);
+  ssd1306_draw_text_aligned(p, p->width / 2, 0, &ssd1306_font_prop8, SSD1306_ALIGN_CENTER, "Leituras");
+  snprintf(line, sizeof(line), "%lu", (unsigned long)snap.rfid_reads);
+  ssd1306_draw_text_aligned(p, p->width / 2, 16, &ssd1306_font_prop16, SSD1306_ALIGN_CENTER, line);
+  snprintf(line, sizeof(line), "Ligado: %lus", (unsigned long)(time_us_64() / 1000000));
+  ssd1306_draw_string(p, 0, 48, 1, line);
+}
+#endif
+
 /*! ---------------------------------------------------------------------------
  *  @brief Inicializa o display OLED SSD1306 via interface I2C.
  *  A função configura os pinos SDA e SCL para comunicação I2C, habilita os 
@@ -144,7 +541,7 @@ void buzzer_pwm_init(void)
  *  definida. Em seguida, realiza a inicialização do display SSD1306 com os 
  *  parâmetros de resolução e endereço I2C. Caso a inicialização falhe, o sistema 
  *  entra em loop travado. Após a inicialização bem-sucedida, exibe uma mensagem 
- *  temporária de "Inicializando..." no display por 2 segundos.
+ *  temporária de "Inicialização..." no display por 2 segundos.
  *
  *  @param[in] (void) : Não recebe parâmetros.
  *
@@ -158,245 +555,1531 @@ void SSD1306_Init(void)
   gpio_set_function(I2C_SCL_PIN, GPIO_FUNC_I2C); // Configura o pino SCL para I2C
   gpio_pull_up(I2C_SDA_PIN); // Habilita pull-up interno para SDA
   gpio_pull_up(I2C_SCL_PIN); // Habilita pull-up interno para SCL
+  ssd1306_bus_config(I2C_PORT, I2C_SDA_PIN, I2C_SCL_PIN, I2C_FREQUENCY); // Pinos para a recuperação do barramento
 
   display.external_vcc = false; // Informa à biblioteca que o VCC é gerado internamente pelo display
 
-  // Inicializa o display SSD1306
-  if (!ssd1306_init(&display, OLED_WIDTH, OLED_HEIGHT, I2C_ADDRESS, I2C_PORT)) 
+  // Inicializa o display conforme o perfil (no modo em faixas o buffer tem uma única página)
+  if (!ssd1306_init_profile(&display, &OLED_PROFILE, I2C_ADDRESS, I2C_PORT, OLED_STRIP_MODE)) 
   {
     printf("Falha ao inicializar SSD1306!\n");
     while(1); // Trava se a inicialização falhar
   }
+  // 180°: remapeamento no controlador; 90°/270°: transposição no flush
+  ssd1306_set_rotation(&display, (ssd1306_rotation_t)(OLED_ROTATION / 90));
   printf("OLED ok!\n");
-  ssd1306_clear(&display);
-  ssd1306_draw_string(&display, 0, 0, 1, "Display Init...");
-  ssd1306_show(&display);
+  ssd1306_render(&display, oled_draw_boot, NULL); // Funciona com buffer inteiro ou em faixas
+
+#if OLED_DUAL
+  // Segundo display no outro controlador, para que os dois envios corram juntos
+  i2c_init(I2C_AUX_PORT, I2C_FREQUENCY);
+  gpio_set_function(I2C_AUX_SDA_PIN, GPIO_FUNC_I2C);
+  gpio_set_function(I2C_AUX_SCL_PIN, GPIO_FUNC_I2C);
+  gpio_pull_up(I2C_AUX_SDA_PIN);
+  gpio_pull_up(I2C_AUX_SCL_PIN);
+  ssd1306_bus_config(I2C_AUX_PORT, I2C_AUX_SDA_PIN, I2C_AUX_SCL_PIN, I2C_FREQUENCY);
+
+  display_aux.external_vcc = false;
+  if (!ssd1306_init_profile(&display_aux, &OLED_PROFILE, I2C_AUX_ADDRESS, I2C_AUX_PORT, false) ||
+      !ssd1306_dma_init(&oled_panels[0], &display) || !ssd1306_dma_init(&oled_panels[1], &display_aux))
+  {
+    printf("Falha ao inicializar o segundo display!\n");
+    while(1);
+  }
+  ssd1306_render(&display_aux, oled_draw_boot, NULL);
+  printf("OLED: pior caso do envio %lu us\n", (unsigned long)ssd1306_dma_show_bound_us(oled_panels, 2));
+#else
+  printf("OLED: pior caso do envio %lu us\n", (unsigned long)ssd1306_show_bound_us(&display));
+#endif
+#if OLED_LAYERS
+  // Camada base do quadro inteiro e uma faixa de páginas para o alerta
+  uint32_t alert_page = display.pages / 4;
+  if (!ssd1306_compositor_init(&oled_layers, &display) ||
+      !ssd1306_layer_init(&oled_alert, &oled_layers, alert_page, display.pages - 2 * alert_page) ||
+      !ssd1306_compositor_add(&oled_layers, &oled_alert))
+  {
+    printf("Falha ao criar as camadas do display!\n");
+    while(1);
+  }
+#endif
+#if OLED_GRAYSCALE
+  if (!ssd1306_gray_init(&oled_gray, &display))
+  {
+    printf("Falha ao criar os planos de cinza!\n");
+    while(1);
+  }
+  // A tela de boot vira o primeiro quadro, em nível máximo
+  memcpy(ssd1306_gray_begin(&oled_gray)->buffer, display.buffer, display.bufsize);
+  ssd1306_gray_paint(&oled_gray, SSD1306_GRAY_LEVELS - 1);
+  // Os planos saem continuamente: o I2C passa ao clock mais rápido que o painel aceita
+  i2c_set_baudrate(I2C_PORT, OLED_GRAY_I2C_FREQUENCY);
+  ssd1306_bus_config(I2C_PORT, I2C_SDA_PIN, I2C_SCL_PIN, OLED_GRAY_I2C_FREQUENCY);
+#endif
   sleep_ms(2000); // Aguarda 2 segundos para exibir a mensagem de inicialização
 }
 
-/* ===========================  DEVELOPMENT TASKS ========================== */
-
 /*! ---------------------------------------------------------------------------
- *  @brief Tarefa responsável por alternar as cores do LED RGB.
- *  A função inicializa os pinos do LED RGB como saída digital e, dentro de um
- *  loop infinito, alterna ciclicamente entre as cores (vermelho, verde e azul),
- *  mantendo cada cor acesa por um intervalo de 500ms.
+ *  @brief Inicia um quadro no display, limpando o buffer.
+ *  As funções oled_* desenham diretamente no buffer (OLED_ON_CORE1=0) ou
+ *  apenas enfileiram comandos para o core 1 (OLED_ON_CORE1=1), e medem quanto
+ *  tempo o core 0 gasta em cada quadro para comparar os dois modos.
  *
- *  @param[in] pvParameters : Parâmetro genérico da tarefa, não utilizado nesta função.
+ *  @param[in] (void) : Não recebe parâmetros.
  *
  *  @return (void) : Não possui valor de retorno.
  * 
  ----------------------------------------------------------------------------*/
-void led_task(void *pvParameters)
+void oled_clear(void)
 {
-  const uint LED_PINS[] = {LED_R_PIN, LED_G_PIN, LED_B_PIN};
-  const uint NUM_COLORS = sizeof(LED_PINS) / sizeof(LED_PINS[0]);
-  uint current_color_index = 0;
+  oled_frame_start_us = time_us_64();
+#if OLED_ON_CORE1
+  display_core1_clear();
+#elif APP_LVGL
+  lvgl_port_lock(); // Liberado em oled_show()
+  oled_label_next = 0;
+#elif OLED_GRAYSCALE
+  ssd1306_gray_clear(&oled_gray, 0);
+  oled_level = SSD1306_GRAY_LEVELS - 1;
+#else
+  ssd1306_clear(OLED_CANVAS);
+#endif
+}
 
-  // Inicializa os pinos do LED como saída e os desliga
-  for (uint i = 0; i < NUM_COLORS; ++i)
+#if APP_LVGL
+/*! ---------------------------------------------------------------------------
+ *  @brief Aplica uma chamada oled_draw_* ao próximo rótulo do LVGL. Texto,
+ *  fonte e posição só são reescritos quando mudam, então o LVGL invalida (e
+ *  o port envia) apenas as áreas que de fato mudaram no quadro.
+ *
+ *  @param[in] x     : Âncora horizontal (conforme `align`).
+ *  @param[in] y     : Posição vertical do topo do texto.
+ *  @param[in] font  : Fonte do LVGL.
+ *  @param[in] align : Alinhamento em relação a `x`.
+ *  @param[in] s     : Texto.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+static void oled_label_put(int32_t x, int32_t y, const lv_font_t *font, ssd1306_align_t align, const char *s)
+{
+  if (oled_label_next >= OLED_LV_LABELS)
   {
-    gpio_init(LED_PINS[i]);
-    gpio_set_dir(LED_PINS[i], GPIO_OUT);
-    gpio_put(LED_PINS[i], 0); // Garante que o LED comece desligado
+    return;
   }
+  oled_label_t *label = &oled_labels[oled_label_next++];
 
-  while (true)
+  if (label->obj == NULL)
   {
-    gpio_put(LED_PINS[current_color_index], 0); // Desliga a cor atual
+    label->obj = lv_label_create(lv_screen_active());
+    label->x = -1; // Força o primeiro posicionamento
+  }
+  if (strcmp(lv_label_get_text(label->obj), s) != 0)
+  {
+    lv_label_set_text(label->obj, s);
+  }
+  if (label->font != font)
+  {
+    lv_obj_set_style_text_font(label->obj, font, 0);
+    label->font = font;
+  }
+  if (label->x != x || label->y != y || label->align != align)
+  {
+    int32_t width = display.width;
+    switch (align)
+    {
+    case SSD1306_ALIGN_CENTER:
+      lv_obj_align(label->obj, LV_ALIGN_TOP_MID, x - width / 2, y);
+      break;
+    case SSD1306_ALIGN_RIGHT:
+      lv_obj_align(label->obj, LV_ALIGN_TOP_RIGHT, x - width, y);
+      break;
+    default:
+      lv_obj_align(label->obj, LV_ALIGN_TOP_LEFT, x, y);
+      break;
+    }
+    label->x = x;
+    label->y = y;
+    label->align = align;
+  }
+  if (!label->visible)
+  {
+    lv_obj_remove_flag(label->obj, LV_OBJ_FLAG_HIDDEN);
+    label->visible = true;
+  }
+}
+#endif
 
-    current_color_index = (current_color_index + 1) % NUM_COLORS; // Avança para a próxima cor
+/*! ---------------------------------------------------------------------------
+ *  @brief Desenha um texto no quadro atual com a fonte padrão.
+ *
+ *  @param[in] x     : Posição horizontal inicial.
+ *  @param[in] y     : Posição vertical inicial.
+ *  @param[in] scale : Escala da fonte.
+ *  @param[in] s     : Texto a desenhar.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void oled_draw_string(uint32_t x, uint32_t y, uint32_t scale, const char *s)
+{
+#if OLED_ON_CORE1
+  display_core1_draw_string(x, y, scale, s);
+#elif APP_LVGL
+  oled_label_put(x, y, (scale > 1) ? &lv_font_montserrat_16 : &lv_font_montserrat_8,
+                 SSD1306_ALIGN_LEFT, s);
+#elif OLED_GRAYSCALE
+  ssd1306_draw_string(ssd1306_gray_begin(&oled_gray), x, y, scale, s);
+  ssd1306_gray_paint(&oled_gray, oled_level);
+#else
+  ssd1306_draw_string(OLED_CANVAS, x, y, scale, s);
+#endif
+}
 
-    gpio_put(LED_PINS[current_color_index], 1); // Liga a nova cor
+/*! ---------------------------------------------------------------------------
+ *  @brief Desenha um texto com fonte proporcional, ancorado em `x`.
+ *  A largura usada no alinhamento vem do cache de métricas da biblioteca,
+ *  então redesenhar o mesmo texto a cada quadro não a recalcula.
+ *
+ *  @param[in] x     : Âncora horizontal (borda esquerda, centro ou borda
+ *                     direita, conforme `align`).
+ *  @param[in] y     : Posição vertical do topo do texto.
+ *  @param[in] font  : Fonte proporcional (ssd1306_font_prop8/16).
+ *  @param[in] align : Alinhamento em relação a `x`.
+ *  @param[in] s     : Texto a desenhar.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void oled_draw_text(uint32_t x, uint32_t y, const ssd1306_font_t *font, ssd1306_align_t align, const char *s)
+{
+#if OLED_ON_CORE1
+  display_core1_draw_text(x, y, font, align, s);
+#elif APP_LVGL
+  oled_label_put(x, y, (font->height > 8) ? &lv_font_montserrat_16 : &lv_font_montserrat_8,
+                 align, s);
+#elif OLED_GRAYSCALE
+  ssd1306_draw_text_aligned(ssd1306_gray_begin(&oled_gray), x, y, font, align, s);
+  ssd1306_gray_paint(&oled_gray, oled_level);
+#else
+  ssd1306_draw_text_aligned(OLED_CANVAS, x, y, font, align, s);
+#endif
+}
 
-    vTaskDelay(pdMS_TO_TICKS(500)); // Aguarda 500ms
-  }
+/*! ---------------------------------------------------------------------------
+ *  @brief Escolhe o nível de cinza das próximas chamadas oled_draw_* do
+ *  quadro atual; oled_clear() volta ao nível máximo. Sem OLED_GRAYSCALE o
+ *  display é monocromático e a chamada não tem efeito.
+ *
+ *  @param[in] level : 0 (apagado) a SSD1306_GRAY_LEVELS - 1 (aceso).
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void oled_set_level(uint32_t level)
+{
+#if OLED_GRAYSCALE
+  oled_level = level;
+#else
+  (void)level;
+#endif
 }
 
 /*! ---------------------------------------------------------------------------
- *  @brief Tarefa responsável por gerar um som intermitente no buzzer.
- *  A função aciona o buzzer utilizando PWM com ciclo de trabalho de 50% por 
- *  100ms e, em seguida, o desliga por 900ms, criando um padrão sonoro com 
- *  pulsos a cada 1 segundo. A tarefa é executada de forma contínua dentro de 
- *  um loop infinito.
+ *  @brief Envia o quadro atual ao display e contabiliza o tempo do core 0.
+ *  Mede separadamente o desenho (de oled_clear até aqui), cuja variância
+ *  expõe as falhas do cache XIP, e o quadro completo (desenho + flush).
  *
- *  @param[in] pvParameters : Parâmetro genérico da tarefa, não utilizado nesta função.
+ *  @param[in] (void) : Não recebe parâmetros.
  *
  *  @return (void) : Não possui valor de retorno.
  * 
  ----------------------------------------------------------------------------*/
-void buzzer_task(void *pvParameters)
+void oled_show(void)
 {
-  while (true)
+#if OLED_DUAL
+  ssd1306_clear(&display_aux);
+  oled_draw_aux(&display_aux, NULL); // Entra no tempo de desenho do quadro
+#endif
+#if OLED_STRIP_MODE
+  uint32_t render = oled_strip_draw_us; // Sem o envio das páginas, intercalado ao desenho
+#else
+  uint32_t render = (uint32_t)(time_us_64() - oled_frame_start_us);
+#endif
+  if (render > oled_render_max_us)
   {
-    // Liga o buzzer com 50% do duty (12 bits/2 -> 2048)
-    pwm_set_gpio_level(BUZZER_A_PIN, 2048);
-    vTaskDelay(pdMS_TO_TICKS(100)); // Mantém ligado por 200ms
-    pwm_set_gpio_level(BUZZER_A_PIN, 0);  // Desliga o buzzer
+    oled_render_max_us = render;
+  }
+  oled_render_sum_us += render;
+  oled_render_sq_sum += (uint64_t)render * render;
+  metrics_observe(HIST_DISPLAY_RENDER_US, render);
+#if APP_CLOCK_SCALING
+  clock_busy_us += render; // Carga de CPU vista pelo governador (o flush é limitado pelo I2C)
+#endif
+
+#if OLED_ON_CORE1
+  display_core1_show(); // Flush e contagem de quadros medidos no core 1
+#elif APP_LVGL
+  for (uint i = oled_label_next; i < OLED_LV_LABELS; ++i) // Rótulos não usados neste quadro
+  {
+    if (oled_labels[i].visible)
+    {
+      lv_obj_add_flag(oled_labels[i].obj, LV_OBJ_FLAG_HIDDEN);
+      oled_labels[i].visible = false;
+    }
+  }
+  lvgl_port_unlock();
+  lvgl_port_refresh(); // Renderização e flush parcial na tarefa do LVGL
+#elif OLED_STRIP_MODE
+  // Páginas já enviadas por ssd1306_render(), uma a uma
+#elif OLED_DUAL
+  ssd1306_dma_show_all(oled_panels, 2); // i2c1 e i2c0 em paralelo, por DMA
+#elif OLED_LAYERS
+  ssd1306_compositor_invalidate(&oled_layers, 0, display.pages - 1); // A base mudou inteira
+  ssd1306_compositor_show(&oled_layers);
+#elif OLED_GRAYSCALE
+  gray_core1_publish(&oled_gray); // Os planos saem no core 1, na taxa fixa
+#else
+  ssd1306_show(&display);
+#endif
 
-    vTaskDelay(pdMS_TO_TICKS(900)); // Aguarda 700ms, completando ciclos de 1 seg
+  uint32_t elapsed = (uint32_t)(time_us_64() - oled_frame_start_us);
+#if !OLED_ON_CORE1 && !APP_LVGL
+  metrics_observe(HIST_DISPLAY_FLUSH_US, elapsed - render);
+  metrics_inc(METRIC_DISPLAY_FRAMES);
+#endif
+  if (elapsed > oled_frame_max_us)
+  {
+    oled_frame_max_us = elapsed;
   }
+  oled_frame_sum_us += elapsed;
+  ++oled_frame_count;
 }
 
+#if OLED_STRIP_MODE
 /*! ---------------------------------------------------------------------------
- *  @brief Tarefa responsável por monitorar os botões e controlar outras tarefas.
- *  A função inicializa dois botões como entrada com pull-up interno e faz a 
- *  leitura do estado deles de forma contínua. Ao detectar o acionamento do 
- *  Botão A, alterna entre suspender e retomar a tarefa do LED. Da mesma forma, 
- *  ao detectar o acionamento do Botão B, alterna entre suspender e retomar 
- *  a tarefa do buzzer. A detecção é feita por meio de borda de subida, 
- *  garantindo que a ação ocorra apenas uma vez por clique. A leitura é realizada 
- *  a cada 100ms, o que também contribui para o efeito de debouncing.
+ *  @brief Desenha uma página do quadro (callback de ssd1306_render): a tela
+ *  inteira é executada e a biblioteca descarta o que cai fora da página.
+ ----------------------------------------------------------------------------*/
+static void oled_strip_page(ssd1306_t *p, void *arg)
+{
+  const oled_strip_call_t *call = arg;
+  uint64_t start = time_us_64();
+
+  call->screen(call->ctx);
+  oled_strip_draw_us += (uint32_t)(time_us_64() - start);
+}
+#endif
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Desenha e envia um quadro completo a partir de uma tela.
+ *  Com o buffer inteiro equivale a oled_clear(), screen(ctx) e oled_show().
+ *  No modo em faixas (OLED_STRIP_MODE) a tela é executada uma vez por página
+ *  sobre um buffer de uma única página, que é enviado assim que termina: o
+ *  desenho custa até 8x mais CPU e o buffer ocupa 128 B em vez de 1 KB.
  *
- *  @param[in] pvParameters : Parâmetro genérico da tarefa, não utilizado nesta função.
+ *  @param[in] screen : Tela a desenhar (apenas chamadas oled_draw_*).
+ *  @param[in] ctx    : Dados da tela, repassados a `screen`.
  *
  *  @return (void) : Não possui valor de retorno.
- * 
+ *
  ----------------------------------------------------------------------------*/
-void button_task(void *pvParameters)
+void oled_render(oled_screen_t screen, const void *ctx)
 {
-  // Inicializa o pino do Botão A como entrada com pull-up interno
-  gpio_init(BUTTON_A_PIN);
-  gpio_set_dir(BUTTON_A_PIN, GPIO_IN);
-  gpio_pull_up(BUTTON_A_PIN);
-
-  // Inicializa o pino do Botão B como entrada com pull-up interno
-  gpio_init(BUTTON_B_PIN);
-  gpio_set_dir(BUTTON_B_PIN, GPIO_IN);
-  gpio_pull_up(BUTTON_B_PIN);
+  oled_clear();
+#if OLED_STRIP_MODE
+  oled_strip_call_t call = { screen, ctx };
+  oled_strip_draw_us = 0;
+  ssd1306_render(&display, oled_strip_page, &call);
+#else
+  screen(ctx);
+#endif
+  oled_show();
+}
 
-  bool button_a_pressed_previously = false; // Estado anterior do Botão A
-  bool button_b_pressed_previously = false; // Estado anterior do Botão B
-  bool led_task_suspended = false;          // Flag para indicar se a tarefa do LED está suspensa
-  bool buzzer_task_suspended = false;       // Flag para indicar se a tarefa do Buzzer está suspensa
+/*! ---------------------------------------------------------------------------
+ *  @brief Tela de erro na criação das tarefas.
+ *
+ *  @param[in] ctx : Não utilizado.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void oled_screen_error(const void *ctx)
+{
+  oled_draw_string(0, 0, 1, "Erro na criação");
+  oled_draw_string(0, 10, 1, "das tarefas!");
+}
 
-  while (true)
-  {
-    // Leitura do Botão A (ativo em nível baixo devido ao pull-up)
-    bool button_a_currently_pressed = !gpio_get(BUTTON_A_PIN);
+/*! ---------------------------------------------------------------------------
+ *  @brief Apaga todas as cores do LED RGB ao pausar o worker do LED.
+ *
+ *  @param[in] arg : Não utilizado.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void led_park(void *arg)
+{
+  gpio_put(LED_R_PIN, 0);
+  gpio_put(LED_G_PIN, 0);
+  gpio_put(LED_B_PIN, 0);
+}
 
-    // Verifica se houve uma borda de subida (botão foi pressionado agora mas não antes)
-    if (button_a_currently_pressed && !button_a_pressed_previously)
-    {
-      if (led_task_suspended)
-      {
-        vTaskResume(xLedTaskHandle); // Resume a tarefa do LED
-        led_task_suspended = false;
-        printf("Tarefa LED Retomada\n");
-      }
-      else
-      {
-        vTaskSuspend(xLedTaskHandle); // Suspende a tarefa do LED
-        led_task_suspended = true;
-        printf("Tarefa LED Suspensa\n");
-      }
-    }
-    button_a_pressed_previously = button_a_currently_pressed; // Atualiza o estado anterior do Botão A
+/*! ---------------------------------------------------------------------------
+ *  @brief Silencia o buzzer ao pausar o worker do buzzer.
+ *
+ *  @param[in] arg : Não utilizado.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void buzzer_park(void *arg)
+{
+  pwm_set_gpio_level(BUZZER_A_PIN, 0);
+}
 
-    // Leitura do Botão B (ativo em nível baixo devido ao pull-up)
-    bool button_b_currently_pressed = !gpio_get(BUTTON_B_PIN);
+#if APP_WCET
+/*! ---------------------------------------------------------------------------
+ *  @brief Prepara a captura de WCET.
+ *  Associa um relógio de CPU a cada tarefa da aplicação e descreve cada job
+ *  (tarefa, prioridade, período e deadline) para o tools/rta.py. Jobs
+ *  esporádicos usam o intervalo mínimo entre ativações como período.
+ *
+ *  @param[in] (void) : Não recebe parâmetros.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void app_wcet_setup(void)
+{
+#if APP_USE_DISPATCHER
+  wcet_attach_task(xDispatchTaskHandle);
 
-    // Verifica se houve uma borda de subida (botão foi pressionado agora mas não antes)
-    if (button_b_currently_pressed && !button_b_pressed_previously)
-    {
-      if (buzzer_task_suspended)
-      {
-          vTaskResume(xBuzzerTaskHandle); // Resume a tarefa do Buzzer
-          buzzer_task_suspended = false;
-          printf("Tarefa Buzzer Retomada\n");
-      }
-      else
-      {
-          vTaskSuspend(xBuzzerTaskHandle); // Suspende a tarefa do Buzzer
-          buzzer_task_suspended = true;
-          printf("Tarefa Buzzer Suspensa\n");
-      }
-    }
-    button_b_pressed_previously = button_b_currently_pressed; // Atualiza o estado anterior do Botão B
+  // Todos os handlers executam na mesma tarefa, sem preempção entre si
+  wcet_register(WCET_INPUT, "input", "Dispatch_Task", APP_TASK_PRIORITY,
+                INPUT_SCAN_PERIOD_MS * 1000, 4 * INPUT_SCAN_PERIOD_MS * 1000);
+  wcet_register(WCET_TICK, "tick", "Dispatch_Task", APP_TASK_PRIORITY,
+                APP_TICK_PERIOD_MS * 1000, APP_TICK_PERIOD_MS * 1000);
+  wcet_register(WCET_RFID, "rfid", "Dispatch_Task", APP_TASK_PRIORITY,
+                250 * 1000, 250 * 1000);
+  wcet_register(WCET_DISPLAY, "display", "Dispatch_Task", APP_TASK_PRIORITY,
+                250 * 1000, 250 * 1000);
+#else
+  wcet_attach_task(xLedTaskHandle);
+  wcet_attach_task(xBuzzerTaskHandle);
+  wcet_attach_task(xButtonTaskHandle);
+  wcet_attach_task(xOledTaskHandle);
 
-    vTaskDelay(pdMS_TO_TICKS(100)); // Verifica os botões a cada 100ms para debouncing e responsividade
-  }
+  wcet_register(WCET_LED, "led", "LED_Task", APP_TASK_PRIORITY,
+                LED_STEP_MS * 1000, LED_STEP_MS * 1000);
+  // Bipe e silêncio alternam; o intervalo mínimo entre acionamentos é o bipe
+  wcet_register(WCET_BUZZER, "buzzer", "Buzzer_Task", APP_TASK_PRIORITY,
+                BUZZER_ON_MS * 1000, BUZZER_ON_MS * 1000);
+  wcet_register(WCET_BUTTON, "button", "Button_Task", BUTTON_TASK_PRIORITY,
+                INPUT_SCAN_PERIOD_MS * 1000, INPUT_SCAN_PERIOD_MS * 1000);
+  // Redesenho esporádico; deadline igual ao antigo período de atualização
+  wcet_register(WCET_OLED, "oled", "OLED_Task", APP_TASK_PRIORITY,
+                250 * 1000, 250 * 1000);
+#endif
 }
+#endif /* APP_WCET */
 
+#if I2C_BUS_MANAGER
 /*! ---------------------------------------------------------------------------
- *  @brief Tarefa responsável por exibir no display OLED o status das tarefas LED e Buzzer.
- *  A função monitora continuamente o estado das tarefas LED e Buzzer por meio 
- *  dos seus handles e exibe no display OLED se cada uma está "Em execução", 
- *  "Suspensa" ou com "Handle Nulo" (quando não foi inicializada corretamente). 
- *  A atualização do display ocorre a cada 250ms. A função também aguarda até 
- *  que os handles das tarefas estejam válidos antes de iniciar a exibição, 
- *  garantindo que não ocorram leituras inválidas.
+ *  @brief Entrega o i2c1 ao gerenciador e passa o display a escrever por
+ *  ele. O display entra com a menor prioridade: seus quadros são fatiados e
+ *  qualquer outro cliente do barramento passa à frente entre as fatias.
  *
- *  @param[in] pvParameters : Parâmetro genérico da tarefa, não utilizado nesta função.
+ *  @param[in] (void) : Não recebe parâmetros.
  *
  *  @return (void) : Não possui valor de retorno.
  * 
  ----------------------------------------------------------------------------*/
-void oled_task(void *pvParameters) 
+void app_i2c_bus_setup(void)
 {
-  char led_status_str[25];    // String para armazenar o status da tarefa LED
-  char buzzer_status_str[25]; // String para armazenar o status da tarefa Buzzer
-  eTaskState led_state;       // Enum para armazenar o estado da tarefa LED
-  eTaskState buzzer_state;    // Enum para armazenar o estado da tarefa Buzzer
-
-  // Aguarda até que os handles das tarefas LED e Buzzer sejam válidos.
-  // Necessário caso esta tarefa inicie antes da criação completa das outras.
-  while(xLedTaskHandle == NULL || xBuzzerTaskHandle == NULL) 
+  if (!i2c_bus_start(&oled_bus, I2C_PORT, "I2C1_Task", I2C_BUS_STACK_WORDS, I2C_BUS_TASK_PRIORITY) ||
+      !i2c_bus_client_init(&oled_bus_client, "oled"))
   {
-    vTaskDelay(pdMS_TO_TICKS(10)); // Pequeno delay para não sobrecarregar a CPU
+    printf("Falha ao iniciar o gerenciador do I2C!\n");
+    while(1);
   }
+  ssd1306_set_transport(&display, oled_bus_transport, &oled_bus_client);
+}
 
-  printf("Tarefa OLED Iniciada\n");
-
-  while (true) 
+/*! ---------------------------------------------------------------------------
+ *  @brief Transporte do display pelo gerenciador. Comandos (controle 0x00)
+ *  vão inteiros; dados (controle 0x40) vão em fatias de OLED_BUS_CHUNK
+ *  bytes, já que o SSD1306 mantém o ponteiro de coluna/página entre
+ *  transações. Antes do escalonador (a tela de erro do main) a tarefa do
+ *  gerenciador ainda não roda, então a escrita vai direto ao i2c1.
+ *
+ *  @param[in] ctx     : Cliente do display.
+ *  @param[in] address : Endereço do display.
+ *  @param[in] src     : Byte de controle seguido dos bytes.
+ *  @param[in] len     : Tamanho de src.
+ *
+ *  @return (int) : len, ou PICO_ERROR_GENERIC / PICO_ERROR_TIMEOUT.
+ * 
+ ----------------------------------------------------------------------------*/
+int HOT_FUNC(oled_bus_transport)(void *ctx, uint8_t address, const uint8_t *src, size_t len)
+{
+  if (xTaskGetSchedulerState() != taskSCHEDULER_RUNNING)
   {
-    // Obtém o estado da tarefa LED, verificando se o handle é válido
-    if (xLedTaskHandle != NULL)
-    {
-      led_state = eTaskGetState(xLedTaskHandle);
-    } 
-    else 
-    {
-      led_state = eInvalid; // Define como estado inválido se o handle for nulo
-    }
+    return i2c_write_timeout_us(I2C_PORT, address, src, len, false, ssd1306_write_timeout_us(len));
+  }
 
-    // Obtém o estado da tarefa Buzzer, verificando se o handle é válido
-    if (xBuzzerTaskHandle != NULL) 
-    {
-      buzzer_state = eTaskGetState(xBuzzerTaskHandle);
-    } 
-    else 
-    {
-      buzzer_state = eInvalid; // Define como estado inválido se o handle for nulo
-    }
-    
-    ssd1306_clear(&display); // Limpa o buffer do display antes de desenhar
+  i2c_bus_txn_t txn = {
+    .client = ctx,
+    .address = address,
+    .priority = I2C_BUS_PRIO_LOW,
+    .chunk = (src[0] == 0x40) ? OLED_BUS_CHUNK : 0,
+    .tx = src,
+    .tx_len = len,
+  };
+  return i2c_bus_transfer(&oled_bus, &txn);
+}
+#endif /* I2C_BUS_MANAGER */
 
-    // Formata e exibe o status da tarefa LED
-    if (led_state != eInvalid) 
-    {
-      sprintf(led_status_str, "Task LED: %s",(led_state == eSuspended) ? "Suspended" : "Run");
-    } 
-    else 
-    {
-      sprintf(led_status_str, "LED: Handle Nulo");
-    }
-    ssd1306_draw_string(&display, 0, 0, 1, led_status_str); // Desenha na linha 0
+#if APP_CLOCK_SCALING
+/*! ---------------------------------------------------------------------------
+ *  @brief Inicia o escalonamento de clock e registra os periféricos.
+ *  Depois do registro, os divisores do PWM do buzzer e os baud rates do I2C
+ *  e da UART passam a ser recalculados a cada troca de nível.
+ *
+ *  @param[in] (void) : Não recebe parâmetros.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void app_clock_setup(void)
+{
+  if (!clock_scale_init(CLOCK_LEVEL_NORMAL))
+  {
+    printf("Falha ao configurar o clock inicial!\n");
+  }
+  clock_scale_register(app_clock_retime, NULL);
+}
 
-    // Formata e exibe o status da tarefa Buzzer
-    if (buzzer_state != eInvalid) 
-    {
-      sprintf(buzzer_status_str, "Task Buzz: %s",(buzzer_state == eSuspended) ? "Suspended" : "Run");
-    } 
-    else 
-    {
-        sprintf(buzzer_status_str, "Buzzer: Handle Nulo");
-    }
-    ssd1306_draw_string(&display, 0, 10, 1, buzzer_status_str); // Desenha na linha 10 (abaixo da primeira)
+/*! ---------------------------------------------------------------------------
+ *  @brief Retemporiza os periféricos derivados de clk_sys.
+ *  Antes da troca, espera a UART terminar de transmitir; depois, recalcula o
+ *  divisor do buzzer (mesmo tom em qualquer nível) e os baud rates. O I2C não
+ *  precisa esperar: as trocas só são pedidas pelo dono do barramento, entre
+ *  transferências. O timer de hardware (timeouts, repeating timers) vem de
+ *  clk_ref e não é afetado; o SysTick é tratado pelo próprio clock_scale.
+ *
+ *  @param[in] phase  : Antes ou depois da troca.
+ *  @param[in] sys_hz : Frequência de clk_sys do novo nível.
+ *  @param[in] ctx    : Não utilizado.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void app_clock_retime(clock_scale_phase_t phase, uint32_t sys_hz, void *ctx)
+{
+  if (phase == CLOCK_SCALE_PRE)
+  {
+#if LIB_PICO_STDIO_UART
+    uart_tx_wait_blocking(uart_default); // Não corta o caractere em transmissão
+#endif
+    return;
+  }
 
-    ssd1306_show(&display); // Atualiza o display físico com o conteúdo do buffer
+  pwm_set_clkdiv(pwm_gpio_to_slice_num(BUZZER_A_PIN), BUZZER_CLKDIV(sys_hz));
+  i2c_set_baudrate(I2C_PORT, I2C_FREQUENCY);
+#if OLED_DUAL
+  i2c_set_baudrate(I2C_AUX_PORT, I2C_FREQUENCY);
+#endif
+#if LIB_PICO_STDIO_UART
+  uart_set_baudrate(uart_default, PICO_DEFAULT_UART_BAUD_RATE); // clk_peri segue clk_sys
+#endif
+}
 
-    vTaskDelay(pdMS_TO_TICKS(250)); // Atualiza o display a cada 250ms
+/*! ---------------------------------------------------------------------------
+ *  @brief Nível mínimo do governador de clock.
+ *  Com LED e buzzer pausados o sistema só espera por eventos e pode ficar no
+ *  nível econômico; caso contrário não desce do nível normal.
+ *
+ *  @param[in] (void) : Não recebe parâmetros.
+ *
+ *  @return (clock_level_t) : Nível desejado.
+ * 
+ ----------------------------------------------------------------------------*/
+clock_level_t app_clock_idle_level(void)
+{
+  if (run_control_is_running(LED_WORKER) || run_control_is_running(BUZZER_WORKER))
+  {
+    return CLOCK_LEVEL_NORMAL;
   }
+  return CLOCK_LEVEL_ECO;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Governador de clock: escolhe o nível pela carga sustentada.
+ *  A cada CLOCK_GOVERN_WINDOW_MS mede a fração do tempo gasta desenhando
+ *  quadros. Acima de CLOCK_UP_PERMIL sobe um nível na hora; só desce um
+ *  nível depois de CLOCK_DOWN_WINDOWS janelas seguidas abaixo de
+ *  CLOCK_DOWN_PERMIL, e nunca abaixo de app_clock_idle_level(), que vale
+ *  de imediato quando sobe. Assim as trocas (religamento do PLL e, para o
+ *  boost, a espera da tensão do núcleo) ficam raras em vez de acontecer a
+ *  cada quadro. Uma troca retemporiza o I2C, então a função só é chamada
+ *  pelo dono do barramento entre quadros: o tick no modo despachante e a
+ *  tarefa OLED no modo de uma tarefa por funcionalidade.
+ *
+ *  @param[in] (void) : Não recebe parâmetros.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void app_clock_govern(void)
+{
+  static uint64_t window_start_us = 0; // Início da janela atual
+  static uint32_t quiet_windows = 0;   // Janelas seguidas com carga baixa
+  clock_level_t level = clock_scale_get_level();
+  clock_level_t min_level = app_clock_idle_level();
+  uint64_t now = time_us_64();
+
+  if (level < min_level) // LED ou buzzer retomados
+  {
+    clock_scale_set(min_level);
+    level = min_level;
+  }
+  if (now - window_start_us < CLOCK_GOVERN_WINDOW_MS * 1000u)
+  {
+    return;
+  }
+
+  uint32_t load = (uint32_t)((uint64_t)clock_busy_us * 1000u / (now - window_start_us));
+  window_start_us = now;
+  clock_busy_us = 0;
+
+  if (load > CLOCK_UP_PERMIL && level < CLOCK_LEVEL_BOOST)
+  {
+    clock_scale_set((clock_level_t)(level + 1));
+    quiet_windows = 0;
+  }
+  else if (load < CLOCK_DOWN_PERMIL && level > min_level)
+  {
+    if (++quiet_windows >= CLOCK_DOWN_WINDOWS)
+    {
+      clock_scale_set((clock_level_t)(level - 1));
+      quiet_windows = 0;
+    }
+  }
+  else
+  {
+    quiet_windows = 0;
+  }
+}
+#endif /* APP_CLOCK_SCALING */
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Publica no estado do sistema o estado de execução dos workers.
+ *  Chamada na inicialização e a cada transição efetiva (on_run_state_change).
+ *
+ *  @param[in] (void) : Não recebe parâmetros.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void app_publish_run_state(void)
+{
+  bool led = run_control_is_running(LED_WORKER);
+  bool buzzer = run_control_is_running(BUZZER_WORKER);
+
+  sys_status_t *st = sys_status_write_begin();
+  st->led_running = led;
+  st->buzzer_running = buzzer;
+  sys_status_write_end();
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Imprime um retrato do estado do sistema na linha de telemetria
+ *  STATUS,<seq>,<ms>,<led>,<buzzer>,<tags>,<heap_livre>,<heap_min>,<trocas/s>,<clk_hz>
+ *  Usada pelo relatório periódico e pelo comando "status" do console.
+ *
+ *  @param[in] (void) : Não recebe parâmetros.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void app_print_status(void)
+{
+  sys_status_t snap;
+  uint32_t seq = sys_status_read(&snap);
+
+  printf("STATUS,%lu,%lu,%d,%d,%lu,%lu,%lu,%lu,%lu\n", (unsigned long)seq,
+         (unsigned long)snap.updated_ms, snap.led_running, snap.buzzer_running,
+         (unsigned long)snap.rfid_reads, (unsigned long)snap.heap_free,
+         (unsigned long)snap.heap_min, (unsigned long)snap.ctx_switches_per_s,
+         (unsigned long)snap.sys_clock_hz);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Hook do driver SSD1306, chamado após cada escrita I2C: alimenta as
+ *  métricas do barramento (escritas, bytes, NACKs, timeouts e duração).
+ *
+ *  @param[in] len        : Bytes escritos (no envio por DMA, o quadro inteiro).
+ *  @param[in] result     : len, PICO_ERROR_GENERIC (NACK) ou PICO_ERROR_TIMEOUT.
+ *  @param[in] elapsed_us : Duração da escrita.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void HOT_FUNC(ssd1306_i2c_hook)(size_t len, int result, uint32_t elapsed_us)
+{
+  metrics_inc(METRIC_I2C_WRITES);
+  if (result == PICO_ERROR_GENERIC)
+  {
+    metrics_inc(METRIC_I2C_NACKS);
+  }
+  else if (result == PICO_ERROR_TIMEOUT)
+  {
+    metrics_inc(METRIC_I2C_TIMEOUTS);
+  }
+  else
+  {
+    metrics_add(METRIC_I2C_BYTES, len);
+  }
+  metrics_observe(HIST_I2C_WRITE_US, elapsed_us);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Registra os comandos do console e liga o aviso de entrada.
+ *
+ *  @param[in] on_input : Callback de IRQ que acorda quem atende o console.
+ *  @param[in] param    : Parâmetro repassado ao callback.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void app_console_setup(void (*on_input)(void *), void *param)
+{
+  console_register("metrics", "despeja as metricas ('metrics reset' zera)", cmd_metrics);
+  console_register("status", "imprime o retrato do sistema", cmd_status);
+  console_init(on_input, param);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Comando "metrics": serializa todas as métricas ou as zera.
+ ----------------------------------------------------------------------------*/
+void cmd_metrics(const char *args)
+{
+  if (strcmp(args, "reset") == 0)
+  {
+    metrics_reset();
+    printf("metricas zeradas\n");
+    return;
+  }
+  metrics_dump();
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Comando "status": imprime o retrato atual do sistema.
+ ----------------------------------------------------------------------------*/
+void cmd_status(const char *args)
+{
+  app_print_status();
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Imprime periodicamente o uso de RAM e a taxa de trocas de contexto.
+ *  Permite comparar o modo despachante (APP_USE_DISPATCHER=1) com o modo de
+ *  uma tarefa por funcionalidade. Deve ser chamada de forma periódica por uma
+ *  tarefa; só imprime a cada APP_STATS_PERIOD_MS.
+ *
+ *  @param[in] (void) : Não recebe parâmetros.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void app_report_stats(void)
+{
+  static TickType_t last_report = 0;  // Tick do último relatório
+  static uint32_t last_switches = 0;  // Trocas de contexto no último relatório
+
+  TickType_t now = xTaskGetTickCount();
+  if ((now - last_report) < pdMS_TO_TICKS(APP_STATS_PERIOD_MS))
+  {
+    return;
+  }
+
+  uint32_t switches = ulContextSwitchCount;
+  uint32_t elapsed_ms = (now - last_report) * portTICK_PERIOD_MS;
+#if APP_USE_DISPATCHER
+  const uint32_t app_stack_bytes = DISPATCH_STACK_WORDS * sizeof(StackType_t);
+#else
+  const uint32_t app_stack_bytes = 5 * APP_TASK_STACK_WORDS * sizeof(StackType_t);
+#endif
+
+  // Publica as métricas do período; o relatório abaixo lê apenas o retrato
+  sys_status_t *st = sys_status_write_begin();
+  st->heap_free = xPortGetFreeHeapSize();
+  st->heap_min = xPortGetMinimumEverFreeHeapSize();
+  st->ctx_switches_per_s = (switches - last_switches) * 1000u / elapsed_ms;
+  st->sys_clock_hz = clock_get_hz(clk_sys);
+  sys_status_write_end();
+  metrics_set(GAUGE_HEAP_FREE, xPortGetFreeHeapSize());
+
+  sys_status_t snap;
+  sys_status_read(&snap);
+
+  printf("[stats] modo=%s tarefas=%lu pilhas_app=%luB heap_livre=%luB heap_min=%luB trocas_ctx/s=%lu\n",
+         APP_USE_DISPATCHER ? "dispatcher" : "task-per-feature",
+         (unsigned long)uxTaskGetNumberOfTasks(), (unsigned long)app_stack_bytes,
+         (unsigned long)snap.heap_free, (unsigned long)snap.heap_min,
+         (unsigned long)snap.ctx_switches_per_s);
+
+  app_print_status(); // Telemetria
+
+  // Custo de cada quadro do display para o core 0 (desenho + flush no modo
+  // de core único; apenas enfileiramento no modo core 1)
+  printf("[stats] oled=%s buf_bytes=%lu quadros=%lu core0_us_med=%lu core0_us_max=%lu\n",
+         OLED_ON_CORE1 ? "core1" : (APP_LVGL ? "lvgl" : (OLED_STRIP_MODE ? "strip" : (OLED_DUAL ? "dual" : (OLED_GRAYSCALE ? "gray" : "core0")))),
+         (unsigned long)display.bufsize, (unsigned long)oled_frame_count,
+         (unsigned long)(oled_frame_count ? oled_frame_sum_us / oled_frame_count : 0),
+         (unsigned long)oled_frame_max_us);
+  if (oled_frame_count != 0)
+  {
+    uint64_t mean = oled_render_sum_us / oled_frame_count;
+    uint64_t var = oled_render_sq_sum / oled_frame_count - mean * mean;
+    printf("[stats] desenho sram=%d carga_flash=%d us_med=%lu us_max=%lu var_us2=%lu\n",
+           HOT_PATH_IN_SRAM, APP_BENCH_FLASH_LOAD, (unsigned long)mean,
+           (unsigned long)oled_render_max_us, (unsigned long)var);
+  }
+  // Erros do I2C do display: contadores acumulados desde o boot
+  ssd1306_bus_stats_t bus = ssd1306_bus_stats;
+  printf("[stats] i2c tentativas=%lu nacks=%lu timeouts=%lu retentativas=%lu recuperacoes=%lu falhas=%lu\n",
+         (unsigned long)bus.writes, (unsigned long)bus.nacks, (unsigned long)bus.timeouts,
+         (unsigned long)bus.retries, (unsigned long)bus.recoveries, (unsigned long)bus.failures);
+#if OLED_ON_CORE1
+  display_core1_stats_t engine;
+  display_core1_get_stats(&engine);
+  printf("[stats] core1 quadros=%lu flush_us=%lu flush_us_max=%lu descartados=%lu\n",
+         (unsigned long)engine.frames, (unsigned long)engine.last_flush_us,
+         (unsigned long)engine.max_flush_us, (unsigned long)engine.dropped);
+#endif
+#if APP_LVGL
+  lvgl_port_stats_t lv;
+  lvgl_port_get_stats(&lv);
+  uint32_t window_ms = lv.window_us / 1000u;
+  printf("[stats] lvgl fps_x10=%lu areas=%lu bytes=%lu cpu_permil=%lu\n",
+         (unsigned long)(window_ms ? lv.frames * 10000u / window_ms : 0),
+         (unsigned long)lv.areas, (unsigned long)lv.bytes,
+         (unsigned long)(lv.window_us ? (uint64_t)lv.busy_us * 1000u / lv.window_us : 0));
+#endif
+#if I2C_BUS_MANAGER
+  // Ocupação do i2c1 e latência de cada cliente (entrega -> fim da transação)
+  i2c_bus_stats_t i2c;
+  i2c_bus_client_stats_t client;
+  i2c_bus_get_stats(&oled_bus, &i2c);
+  i2c_bus_client_get_stats(&oled_bus_client, &client);
+  printf("[stats] i2c_bus transacoes=%lu escritas=%lu preempcoes=%lu ocupacao_permil=%lu\n",
+         (unsigned long)i2c.transactions, (unsigned long)i2c.writes, (unsigned long)i2c.preemptions,
+         (unsigned long)(i2c.window_us ? (uint64_t)i2c.busy_us * 1000u / i2c.window_us : 0));
+  printf("[stats] i2c_cliente %s n=%lu erros=%lu bytes=%lu lat_us_med=%lu lat_us_max=%lu espera_us_max=%lu\n",
+         oled_bus_client.name, (unsigned long)client.transactions, (unsigned long)client.errors,
+         (unsigned long)client.bytes,
+         (unsigned long)(client.transactions ? client.latency_sum_us / client.transactions : 0),
+         (unsigned long)client.latency_max_us, (unsigned long)client.wait_max_us);
+#endif
+#if OLED_GRAYSCALE
+  // Taxa de planos alcançada e custo do motor no core 1 na janela do relatório
+  gray_core1_stats_t gray;
+  gray_core1_get_stats(&gray);
+  uint32_t gray_window_ms = gray.window_us / 1000u;
+  printf("[stats] cinza planos_por_s=%lu paginas_por_plano_x10=%lu atrasados=%lu montagem_us_max=%lu envio_us_max=%lu core1_cpu_permil=%lu\n",
+         (unsigned long)(gray_window_ms ? gray.planes * 1000u / gray_window_ms : 0),
+         (unsigned long)(gray.planes ? gray.pages * 10u / gray.planes : 0),
+         (unsigned long)gray.late, (unsigned long)gray.build_max_us, (unsigned long)gray.send_max_us,
+         (unsigned long)(gray.window_us ? (uint64_t)gray.busy_us * 1000u / gray.window_us : 0));
+#endif
+#if OLED_LAYERS
+  // Páginas recompostas desde o boot: um alerta custa só as páginas da sua faixa
+  printf("[stats] camadas sobreposicoes=%u paginas_compostas=%lu\n",
+         (unsigned)oled_layers.count, (unsigned long)oled_layers.composited);
+#endif
+  oled_frame_max_us = 0;
+  oled_frame_sum_us = 0;
+  oled_render_max_us = 0;
+  oled_render_sum_us = 0;
+  oled_render_sq_sum = 0;
+  oled_frame_count = 0;
+
+#if APP_CLOCK_SCALING
+  clock_scale_stats_t clk;
+  clock_scale_get_stats(&clk);
+  printf("[stats] clock nivel=%s eco_ms=%lu normal_ms=%lu boost_ms=%lu trocas=%lu troca_us_max=%lu\n",
+         clock_scale_level_name(clk.level),
+         (unsigned long)(clk.time_us[CLOCK_LEVEL_ECO] / 1000),
+         (unsigned long)(clk.time_us[CLOCK_LEVEL_NORMAL] / 1000),
+         (unsigned long)(clk.time_us[CLOCK_LEVEL_BOOST] / 1000),
+         (unsigned long)clk.transitions, (unsigned long)clk.max_switch_us);
+#endif
+
+#if APP_WCET
+  wcet_report(); // Linhas WCET,... para o tools/rta.py
+#endif
+
+  last_report = now;
+  last_switches = switches;
+}
+
+/* ===========================  DEVELOPMENT TASKS ========================== */
+
+#if APP_BENCH_FLASH_LOAD
+/*! ---------------------------------------------------------------------------
+ *  @brief Tarefa de carga para o benchmark de variância do desenho.
+ *  Percorre toda a imagem gravada na flash com passo de 8 bytes (uma linha do
+ *  cache XIP por leitura), expulsando continuamente o conteúdo do cache de
+ *  16 KB. Com a mesma prioridade do desenho, o time slicing intercala a carga
+ *  com a renderização.
+ *
+ *  @param[in] pvParameters : Parâmetro genérico da tarefa, não utilizado nesta função.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void flash_load_task(void *pvParameters)
+{
+  extern char __flash_binary_end; // Fim da imagem na flash (linker script)
+  const volatile uint32_t *flash = (const volatile uint32_t *)XIP_BASE;
+  const size_t words = ((uintptr_t)&__flash_binary_end - XIP_BASE) / sizeof(uint32_t);
+  uint32_t acc = 0;
+
+  while (true)
+  {
+    for (size_t i = 0; i < words; i += 2)
+    {
+      acc += flash[i];
+    }
+    flash_load_sink = acc;
+  }
+}
+#endif /* APP_BENCH_FLASH_LOAD */
+
+#if !APP_USE_DISPATCHER
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Tarefa responsável por alternar as cores do LED RGB.
+ *  A função inicializa os pinos do LED RGB como saída digital e, dentro de um
+ *  loop infinito, alterna ciclicamente entre as cores (vermelho, verde e azul),
+ *  mantendo cada cor acesa por um intervalo de 500ms. A troca de cor é o ponto
+ *  seguro: ao ser pausada, a tarefa apaga o LED e bloqueia no bit de execução.
+ *
+ *  @param[in] pvParameters : Parâmetro genérico da tarefa, não utilizado nesta função.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void led_task(void *pvParameters)
+{
+  const uint LED_PINS[] = {LED_R_PIN, LED_G_PIN, LED_B_PIN};
+  const uint NUM_COLORS = sizeof(LED_PINS) / sizeof(LED_PINS[0]);
+  uint current_color_index = 0;
+
+  // Inicializa os pinos do LED como saída e os desliga
+  for (uint i = 0; i < NUM_COLORS; ++i)
+  {
+    gpio_init(LED_PINS[i]);
+    gpio_set_dir(LED_PINS[i], GPIO_OUT);
+    gpio_put(LED_PINS[i], 0); // Garante que o LED comece desligado
+  }
+
+  while (true)
+  {
+    run_control_wait_run(LED_WORKER, led_park, NULL); // Bloqueia aqui enquanto pausada
+
+    WCET_BEGIN(WCET_LED);
+    gpio_put(LED_PINS[current_color_index], 0); // Desliga a cor atual
+
+    current_color_index = (current_color_index + 1) % NUM_COLORS; // Avança para a próxima cor
+
+    gpio_put(LED_PINS[current_color_index], 1); // Liga a nova cor
+    WCET_END(WCET_LED);
+
+    run_control_delay(LED_WORKER, pdMS_TO_TICKS(LED_STEP_MS)); // Aguarda 500ms ou um pedido de pausa
+  }
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Tarefa responsável por gerar um som intermitente no buzzer.
+ *  A função aciona o buzzer utilizando PWM com ciclo de trabalho de 50% por 
+ *  100ms e, em seguida, o desliga por 900ms, criando um padrão sonoro com 
+ *  pulsos a cada 1 segundo. A tarefa é executada de forma contínua dentro de 
+ *  um loop infinito. A pausa só ocorre com o buzzer desligado: o bipe em
+ *  andamento sempre termina, e a espera de 900ms é interrompida pelo pedido.
+ *
+ *  @param[in] pvParameters : Parâmetro genérico da tarefa, não utilizado nesta função.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void buzzer_task(void *pvParameters)
+{
+  while (true)
+  {
+    run_control_wait_run(BUZZER_WORKER, buzzer_park, NULL); // Bloqueia aqui enquanto pausada
+
+    // Liga o buzzer com 50% do duty (12 bits/2 -> 2048)
+    WCET_BEGIN(WCET_BUZZER);
+    pwm_set_gpio_level(BUZZER_A_PIN, 2048);
+    WCET_END(WCET_BUZZER);
+    vTaskDelay(pdMS_TO_TICKS(BUZZER_ON_MS)); // Mantém ligado por 100ms
+    WCET_BEGIN(WCET_BUZZER);
+    pwm_set_gpio_level(BUZZER_A_PIN, 0);  // Desliga o buzzer
+    WCET_END(WCET_BUZZER);
+
+    // Aguarda 900ms, completando ciclos de 1 seg (ou até um pedido de pausa)
+    run_control_delay(BUZZER_WORKER, pdMS_TO_TICKS(BUZZER_CYCLE_MS - BUZZER_ON_MS));
+  }
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Tarefa responsável por monitorar os botões e controlar outras tarefas.
+ *  A função inicializa o scanner de entradas, que amostra todos os GPIOs de
+ *  entrada numa única leitura e faz o debouncing de todos em paralelo. A cada
+ *  INPUT_SCAN_PERIOD_MS os eventos de acionamento, liberação e long-press são
+ *  obtidos como máscaras de bits. Ao acionar o Botão A, alterna entre pausar
+ *  e retomar a tarefa do LED; ao acionar o Botão B, faz o mesmo com a tarefa
+ *  do buzzer. A pausa é apenas um pedido (bit do event group); cada tarefa
+ *  para no seu próximo ponto seguro.
+ *
+ *  @param[in] pvParameters : Parâmetro genérico da tarefa, não utilizado nesta função.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void button_task(void *pvParameters)
+{
+  input_scan_t scanner; // Estado do debouncing de todas as entradas
+  input_events_t events; // Eventos gerados a cada varredura
+
+  input_scan_init(&scanner, INPUT_PINS_MASK, INPUT_ACTIVE_LOW_MASK,
+                  BUTTON_LONG_PRESS_MS / INPUT_SCAN_PERIOD_MS);
+
+  TickType_t last_wake = xTaskGetTickCount();
+
+  while (true)
+  {
+    vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(INPUT_SCAN_PERIOD_MS)); // Varredura periódica
+    WCET_BEGIN(WCET_BUTTON);
+
+    // Sem mudança em nenhuma entrada, a varredura termina aqui
+    if (input_scan_update(&scanner, &events))
+    {
+      uint32_t start = time_us_32();
+      metrics_inc(METRIC_INPUT_EVENTS);
+      metrics_set(GAUGE_INPUT_STATE, scanner.state);
+      metrics_add(METRIC_INPUT_PRESSES, __builtin_popcount(events.pressed));
+      metrics_add(METRIC_INPUT_LONG, __builtin_popcount(events.long_pressed));
+
+      if (events.pressed & (1u << BUTTON_A_PIN))
+      {
+        bool run = run_control_toggle(LED_WORKER); // Pede pausa/retomada do LED
+        printf("Tarefa LED %s\n", run ? "Retomada" : "Suspensa");
+      }
+
+      if (events.pressed & (1u << BUTTON_B_PIN))
+      {
+        bool run = run_control_toggle(BUZZER_WORKER); // Pede pausa/retomada do Buzzer
+        printf("Tarefa Buzzer %s\n", run ? "Retomada" : "Suspensa");
+      }
+
+      if (events.long_pressed)
+      {
+        printf("Long-press nas entradas 0x%08lx\n", (unsigned long)events.long_pressed);
+      }
+      metrics_observe(HIST_INPUT_HANDLE_US, time_us_32() - start);
+    }
+
+    WCET_END(WCET_BUTTON);
+  }
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Tela da tarefa OLED: status das tarefas LED e Buzzer.
+ *
+ *  @param[in] ctx : Retrato do sistema (sys_status_t).
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void oled_screen_tasks(const void *ctx)
+{
+  const sys_status_t *snap = ctx;
+  char line[25]; // Linha formatada
+
+  // Formata e exibe o status da tarefa LED
+  sprintf(line, "Task LED: %s", snap->led_running ? "Run" : "Suspended");
+  oled_draw_string(0, 0, 1, line); // Desenha na linha 0
+
+  // Formata e exibe o status da tarefa Buzzer
+  sprintf(line, "Task Buzz: %s", snap->buzzer_running ? "Run" : "Suspended");
+  oled_draw_string(0, 10, 1, line); // Desenha na linha 10 (abaixo da primeira)
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Tarefa responsável por exibir no display OLED o status das tarefas LED e Buzzer.
+ *  A função exibe no display OLED se cada tarefa está "Run" ou "Suspended",
+ *  conforme o estado publicado pelo controle de execução. Não há polling: a
+ *  tarefa fica bloqueada até ser notificada de uma transição de estado (ver
+ *  on_run_state_change) e só então redesenha o display. A espera termina
+ *  também no prazo absoluto do relatório periódico de estatísticas, que
+ *  transições frequentes não conseguem adiar.
+ *
+ *  @param[in] pvParameters : Parâmetro genérico da tarefa, não utilizado nesta função.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void oled_task(void *pvParameters) 
+{
+  sys_status_t snap; // Retrato do sistema usado em cada redesenho
+  TickType_t report_at = xTaskGetTickCount() + pdMS_TO_TICKS(APP_STATS_PERIOD_MS); // Próximo relatório
+
+  printf("Tarefa OLED Iniciada\n");
+
+  while (true) 
+  {
+    WCET_BEGIN(WCET_OLED);
+    sys_status_read(&snap); // Cópia consistente, sem seção crítica
+    oled_render(oled_screen_tasks, &snap); // Desenha e atualiza o display físico
+    WCET_END(WCET_OLED);
+
+    // Bloqueia até a próxima transição de estado ou até o prazo do relatório
+    uint32_t notified;
+    do
+    {
+      TickType_t now = xTaskGetTickCount();
+      TickType_t wait = ((int32_t)(report_at - now) > 0) ? report_at - now : 0;
+
+      notified = ulTaskNotifyTake(pdTRUE, wait);
+#if APP_CLOCK_SCALING
+      app_clock_govern(); // Esta tarefa é a dona do I2C
+#endif
+      app_report_stats(); // Só imprime a cada APP_STATS_PERIOD_MS
+      now = xTaskGetTickCount();
+      if ((int32_t)(now - report_at) >= 0)
+      {
+        report_at = now + pdMS_TO_TICKS(APP_STATS_PERIOD_MS);
+      }
+    } while (notified == 0);
+  }
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Assinante do controle de execução: publica o novo estado e acorda
+ *  a tarefa OLED. Executado no contexto do worker que acabou de pausar ou
+ *  retomar.
+ *
+ *  @param[in] id      : Worker que mudou de estado.
+ *  @param[in] running : Novo estado publicado.
+ *  @param[in] ctx     : Não utilizado.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void on_run_state_change(uint id, bool running, void *ctx)
+{
+  app_publish_run_state();
+  xTaskNotifyGive(xOledTaskHandle);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Aviso de caracteres disponíveis no stdio (contexto de IRQ).
+ ----------------------------------------------------------------------------*/
+static void console_chars_available(void *param)
+{
+  BaseType_t woken = pdFALSE;
+
+  vTaskNotifyGiveFromISR(xConsoleTaskHandle, &woken);
+  portYIELD_FROM_ISR(woken);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Tarefa responsável pelo console de comandos.
+ *  Bloqueia até o stdio avisar que há caracteres e então executa as linhas
+ *  completas ("help", "metrics", "status").
+ *
+ *  @param[in] pvParameters : Parâmetro genérico da tarefa, não utilizado nesta função.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void console_task(void *pvParameters)
+{
+  app_console_setup(console_chars_available, NULL);
+
+  while (true)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    console_poll();
+  }
+}
+#endif /* !APP_USE_DISPATCHER */
+
+#if APP_USE_DISPATCHER
+/* ========================  DEVELOPMENT OF HANDLERS ======================= */
+
+static const uint led_pins[] = {LED_R_PIN, LED_G_PIN, LED_B_PIN}; // Cores do LED RGB
+static uint led_color_index = 0;        // Cor atualmente acesa
+static uint32_t app_ticks = 0;          // Ticks da aplicação desde o início
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Callback de hardware da varredura de entradas (contexto de IRQ).
+ *  Amostra todas as entradas e só envia eventos ao despachante quando algum
+ *  pino muda de estado, evitando acordar a tarefa a cada varredura.
+ ----------------------------------------------------------------------------*/
+static bool HOT_FUNC(input_scan_timer_cb)(repeating_timer_t *rt)
+{
+  input_events_t events;
+  BaseType_t woken = pdFALSE;
+
+  if (input_scan_update(&input_scanner, &events))
+  {
+    metrics_inc(METRIC_INPUT_EVENTS);
+    metrics_set(GAUGE_INPUT_STATE, input_scanner.state);
+    xQueueSendFromISR(xInputQueue, &events, &woken);
+  }
+  portYIELD_FROM_ISR(woken);
+  return true; // Mantém o timer ativo
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Callback de hardware do tick da aplicação (contexto de IRQ).
+ ----------------------------------------------------------------------------*/
+static bool HOT_FUNC(app_tick_timer_cb)(repeating_timer_t *rt)
+{
+  BaseType_t woken = pdFALSE;
+
+  xSemaphoreGiveFromISR(xTickSemaphore, &woken);
+  portYIELD_FROM_ISR(woken);
+  return true; // Mantém o timer ativo
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Aviso de caracteres disponíveis no stdio (contexto de IRQ).
+ ----------------------------------------------------------------------------*/
+static void console_chars_available(void *param)
+{
+  BaseType_t woken = pdFALSE;
+
+  xSemaphoreGiveFromISR(xConsoleSemaphore, &woken);
+  portYIELD_FROM_ISR(woken);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Solicita ao despachante o redesenho do display.
+ *
+ *  @param[in] message : Nova linha de mensagem, ou NULL para manter a atual.
+ ----------------------------------------------------------------------------*/
+static void request_display(const char *message)
+{
+  display_request_t req = { .has_message = (message != NULL) };
+
+  if (message != NULL)
+  {
+    snprintf(req.message, sizeof(req.message), "%s", message);
+  }
+  // Sem espera: se a fila estiver cheia, um redesenho já está pendente
+  xQueueSend(xDisplayQueue, &req, 0);
+}
+
+#if OLED_LAYERS
+static uint32_t oled_alert_until = 0; // Tick da aplicação em que o alerta expira
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Mostra um alerta sobre a tela de status por OLED_ALERT_MS.
+ *  O alerta é desenhado na sua própria camada (caixa opaca na máscara,
+ *  moldura e texto no conteúdo); só as páginas da faixa do alerta são
+ *  recompostas e enviadas, sem redesenhar a tela base.
+ *
+ *  @param[in] text : Texto do alerta (uma linha).
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+static void oled_alert_show(const char *text)
+{
+  ssd1306_t *canvas = &oled_alert.canvas;
+  uint32_t top = canvas->buf_page * 8;  // Primeira linha da faixa
+  uint32_t rows = canvas->buf_pages * 8; // Altura da faixa
+
+  ssd1306_layer_clear(&oled_alert);
+  ssd1306_draw_square(&oled_alert.mask, 4, top, display.width - 8, rows); // Esconde a base sob a caixa
+  ssd1306_draw_empty_square(canvas, 4, top, display.width - 9, rows - 1);
+  ssd1306_draw_text_aligned(canvas, display.width / 2, top + (rows - ssd1306_font_prop8.height) / 2,
+                            &ssd1306_font_prop8, SSD1306_ALIGN_CENTER, text);
+
+  // Conteúdo novo mesmo que o alerta anterior ainda esteja visível
+  ssd1306_compositor_invalidate(&oled_layers, canvas->buf_page, canvas->buf_page + canvas->buf_pages - 1);
+  ssd1306_compositor_set_visible(&oled_layers, &oled_alert, true);
+  ssd1306_compositor_show(&oled_layers);
+  oled_alert_until = app_ticks + OLED_ALERT_MS / APP_TICK_PERIOD_MS;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Esconde o alerta expirado: a faixa volta a mostrar a base, que
+ *  continua no buffer da camada base.
+ ----------------------------------------------------------------------------*/
+static void oled_alert_expire(void)
+{
+  if (oled_alert.visible && (int32_t)(app_ticks - oled_alert_until) >= 0)
+  {
+    ssd1306_compositor_set_visible(&oled_layers, &oled_alert, false);
+    ssd1306_compositor_show(&oled_layers);
+  }
+}
+#endif
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Executado pela tarefa despachante antes de atender o primeiro evento.
+ *  Inicializa as saídas e só então liga os timers de hardware, garantindo que
+ *  nenhuma ISR use as filas antes do escalonador estar em execução.
+ *
+ *  @param[in] (void) : Não recebe parâmetros.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void app_dispatch_start(void)
+{
+  for (uint i = 0; i < count_of(led_pins); ++i)
+  {
+    gpio_init(led_pins[i]);
+    gpio_set_dir(led_pins[i], GPIO_OUT);
+    gpio_put(led_pins[i], 0); // Garante que o LED comece desligado
+  }
+
+  add_repeating_timer_ms(INPUT_SCAN_PERIOD_MS, input_scan_timer_cb, NULL, &input_scan_timer);
+  add_repeating_timer_ms(APP_TICK_PERIOD_MS, app_tick_timer_cb, NULL, &app_tick_timer);
+  app_console_setup(console_chars_available, NULL);
+
+  printf("Despachante iniciado\n");
+  request_display(NULL);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Handler dos eventos de entrada (botões).
+ *  Botão A pausa/retoma o LED e Botão B pausa/retoma o buzzer.
+ *
+ *  @param[in] item : Ponteiro para input_events_t.
+ *  @param[in] ctx  : Não utilizado.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void on_input_event(const void *item, void *ctx)
+{
+  const input_events_t *events = item;
+  uint32_t start = time_us_32();
+
+  WCET_BEGIN(WCET_INPUT);
+  metrics_add(METRIC_INPUT_PRESSES, __builtin_popcount(events->pressed));
+  metrics_add(METRIC_INPUT_LONG, __builtin_popcount(events->long_pressed));
+  if (events->pressed & (1u << BUTTON_A_PIN))
+  {
+    bool run = run_control_toggle(LED_WORKER); // Pede pausa/retomada do LED
+    printf("Tarefa LED %s\n", run ? "Retomada" : "Suspensa");
+  }
+
+  if (events->pressed & (1u << BUTTON_B_PIN))
+  {
+    bool run = run_control_toggle(BUZZER_WORKER); // Pede pausa/retomada do Buzzer
+    printf("Tarefa Buzzer %s\n", run ? "Retomada" : "Suspensa");
+  }
+
+  if (events->long_pressed)
+  {
+    printf("Long-press nas entradas 0x%08lx\n", (unsigned long)events->long_pressed);
+  }
+  WCET_END(WCET_INPUT);
+  metrics_observe(HIST_INPUT_HANDLE_US, time_us_32() - start);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Handler do tick periódico da aplicação.
+ *  Avança as máquinas de estado do LED RGB (uma cor a cada LED_STEP_MS) e do
+ *  buzzer (BUZZER_ON_MS ligado a cada BUZZER_CYCLE_MS), substituindo as
+ *  tarefas dedicadas do modo uma-tarefa-por-funcionalidade. Os pedidos de
+ *  pausa são atendidos em pontos seguros: qualquer tick para o LED e apenas
+ *  fora do bipe para o buzzer.
+ *
+ *  @param[in] item : Não utilizado (fonte é um semáforo).
+ *  @param[in] ctx  : Não utilizado.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void on_app_tick(const void *item, void *ctx)
+{
+  WCET_BEGIN(WCET_TICK);
+  ++app_ticks;
+
+  // LED: todo tick é ponto seguro; pausado, fica apagado (led_park)
+  if (run_control_checkpoint(LED_WORKER, led_park, NULL) &&
+      (app_ticks % (LED_STEP_MS / APP_TICK_PERIOD_MS)) == 0)
+  {
+    gpio_put(led_pins[led_color_index], 0); // Desliga a cor atual
+    led_color_index = (led_color_index + 1) % count_of(led_pins); // Avança para a próxima cor
+    gpio_put(led_pins[led_color_index], 1); // Liga a nova cor
+  }
+
+  // Buzzer: o bipe em andamento sempre termina; fora dele todo tick é ponto seguro
+  uint32_t phase = (app_ticks % (BUZZER_CYCLE_MS / APP_TICK_PERIOD_MS)) * APP_TICK_PERIOD_MS;
+  if (phase == BUZZER_ON_MS)
+  {
+    pwm_set_gpio_level(BUZZER_A_PIN, 0); // Desliga o buzzer
+  }
+  if (phase == 0 || phase >= BUZZER_ON_MS)
+  {
+    if (run_control_checkpoint(BUZZER_WORKER, buzzer_park, NULL) && phase == 0)
+    {
+      pwm_set_gpio_level(BUZZER_A_PIN, 2048); // Liga o buzzer com 50% do duty
+    }
+  }
+
+#if OLED_LAYERS
+  oled_alert_expire(); // Envia só as páginas do alerta
+#endif
+  WCET_END(WCET_TICK);
+
+#if APP_CLOCK_SCALING
+  app_clock_govern(); // O despachante é o dono do I2C; fora do WCET do tick
+#endif
+  app_report_stats(); // Relatório periódico de RAM e trocas de contexto
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Assinante do controle de execução: publica o novo estado e pede o
+ *  redesenho do display.
+ *  Executado pelo próprio despachante quando LED ou buzzer de fato pausam ou
+ *  retomam, então o display só é redesenhado em transições.
+ *
+ *  @param[in] id      : Worker que mudou de estado.
+ *  @param[in] running : Novo estado publicado.
+ *  @param[in] ctx     : Não utilizado.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void on_run_state_change(uint id, bool running, void *ctx)
+{
+  app_publish_run_state();
+  request_display(NULL);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Handler das tags RFID lidas.
+ *  Imprime o UID da tag e o exibe na linha de mensagem do display.
+ *
+ *  @param[in] item : Ponteiro para rfid_event_t.
+ *  @param[in] ctx  : Não utilizado.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void on_rfid_event(const void *item, void *ctx)
+{
+  const rfid_event_t *tag = item;
+  char line[22] = "Tag:";
+  size_t len = 4;
+  uint32_t start = time_us_32();
+
+  WCET_BEGIN(WCET_RFID);
+  metrics_inc(METRIC_RFID_TAGS);
+  metrics_set(GAUGE_RFID_UID_LEN, tag->uid_len);
+  for (uint8_t i = 0; i < tag->uid_len && i < sizeof(tag->uid) && len + 2 < sizeof(line); ++i)
+  {
+    len += snprintf(&line[len], sizeof(line) - len, "%02X", tag->uid[i]);
+  }
+
+  sys_status_t *st = sys_status_write_begin();
+  ++st->rfid_reads;
+  st->rfid_uid_len = (tag->uid_len < SYS_STATUS_UID_MAX) ? tag->uid_len : SYS_STATUS_UID_MAX;
+  memcpy(st->rfid_uid, tag->uid, st->rfid_uid_len);
+  sys_status_write_end();
+
+  printf("RFID %s\n", line);
+  request_display(line);
+#if OLED_LAYERS
+  oled_alert_show(line); // Sobre a tela atual; a base é redesenhada pela requisição acima
+#endif
+  WCET_END(WCET_RFID);
+  metrics_observe(HIST_RFID_HANDLE_US, time_us_32() - start);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Tela de status do modo despachante: workers, última mensagem e
+ *  contador de tags.
+ *
+ *  @param[in] ctx : Retrato do sistema (sys_status_t).
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void oled_screen_status(const void *ctx)
+{
+  const sys_status_t *snap = ctx;
+  char line[25];
+
+  sprintf(line, "Task LED: %s", snap->led_running ? "Run" : "Suspended");
+  oled_draw_string(0, 0, 1, line); // Desenha na linha 0
+
+  sprintf(line, "Task Buzz: %s", snap->buzzer_running ? "Run" : "Suspended");
+  oled_draw_string(0, 10, 1, line); // Desenha na linha 10
+
+  oled_draw_string(0, 20, 1, snap->message); // Última mensagem
+
+  oled_set_level(2); // Rótulo em cinza (só com OLED_GRAYSCALE)
+  oled_draw_text(0, 44, &ssd1306_font_prop8, SSD1306_ALIGN_LEFT, "Tags");
+  oled_set_level(3);
+  snprintf(line, sizeof(line), "%lu", (unsigned long)snap->rfid_reads);
+  oled_draw_text(display.width, 40, &ssd1306_font_prop16, SSD1306_ALIGN_RIGHT, line); // Contador à direita em 16 px
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Handler das requisições de desenho.
+ *  Redesenha a tela de status apenas quando algo mudou, em vez de atualizar o
+ *  display periodicamente.
+ *
+ *  @param[in] item : Ponteiro para display_request_t.
+ *  @param[in] ctx  : Não utilizado.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void on_display_request(const void *item, void *ctx)
+{
+  const display_request_t *req = item;
+  sys_status_t snap;
+
+  WCET_BEGIN(WCET_DISPLAY);
+  if (req->has_message)
+  {
+    sys_status_t *st = sys_status_write_begin();
+    snprintf(st->message, sizeof(st->message), "%s", req->message);
+    sys_status_write_end();
+  }
+
+  sys_status_read(&snap); // Tudo o que a tela mostra vem de um único retrato
+  oled_render(oled_screen_status, &snap); // Desenha e atualiza o display físico
+  WCET_END(WCET_DISPLAY);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Handler do console: executa as linhas recebidas pelo stdio.
+ *
+ *  @param[in] item : Não utilizado (fonte é um semáforo).
+ *  @param[in] ctx  : Não utilizado.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ * 
+ ----------------------------------------------------------------------------*/
+void on_console_input(const void *item, void *ctx)
+{
+  console_poll();
 }
+#endif /* APP_USE_DISPATCHER */
 /* end program */
\ No newline at end of file
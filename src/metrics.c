@@ -0,0 +1,122 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Registro de métricas: armazenamento e serialização.
+ *
+ *  @file	    metrics.c
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+/* ============================   LIBRARIES  =============================== */
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "metrics.h"
+
+/* =========================   GLOBAL VARIABLES   ========================== */
+
+volatile uint32_t metrics_counters[METRICS_COUNTER_COUNT];
+volatile uint32_t metrics_gauges[METRICS_GAUGE_COUNT];
+metrics_hist_t metrics_hists[METRICS_HIST_COUNT];
+#ifndef NDEBUG
+volatile uint8_t metrics_counter_core[METRICS_COUNTER_COUNT];
+volatile uint8_t metrics_hist_core[METRICS_HIST_COUNT];
+#endif
+
+#define METRICS_NAME(id, name) name,
+static const char *const counter_names[] = { METRICS_COUNTERS(METRICS_NAME) };
+static const char *const gauge_names[] = { METRICS_GAUGES(METRICS_NAME) };
+static const char *const hist_names[] = { METRICS_HISTOGRAMS(METRICS_NAME) };
+
+/* =======================  DEVELOPMENT OF FUNCTIONS ======================= */
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Serializa todas as métricas em texto compacto, uma por linha:
+ *    C,<nome>,<valor>
+ *    G,<nome>,<valor>
+ *    H,<nome>,<amostras>,<soma>,<max>,<b0>,...,<b15>
+ *  O balde k do histograma conta as amostras em [2^(k-1), 2^k) (b0 conta os
+ *  zeros). Cada histograma é copiado com as interrupções mascaradas para que
+ *  a linha seja consistente; a impressão acontece fora dessa janela. Um
+ *  histograma escrito pelo outro core pode ser copiado no meio de uma
+ *  amostra (contagem e soma desencontradas por uma amostra).
+ *
+ *  @param[in] (void) : Não recebe parâmetros.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void metrics_dump(void)
+{
+  printf("M,begin,%lu\n", (unsigned long)to_ms_since_boot(get_absolute_time()));
+
+  for (uint i = 0; i < METRICS_COUNTER_COUNT; ++i)
+  {
+    printf("C,%s,%lu\n", counter_names[i], (unsigned long)metrics_counters[i]);
+  }
+  for (uint i = 0; i < METRICS_GAUGE_COUNT; ++i)
+  {
+    printf("G,%s,%lu\n", gauge_names[i], (unsigned long)metrics_gauges[i]);
+  }
+  for (uint i = 0; i < METRICS_HIST_COUNT; ++i)
+  {
+    metrics_hist_t h;
+    uint32_t irq = save_and_disable_interrupts();
+    h = metrics_hists[i];
+    restore_interrupts(irq);
+
+    printf("H,%s,%lu,%lu,%lu", hist_names[i], (unsigned long)h.count,
+           (unsigned long)h.sum, (unsigned long)h.max);
+    for (uint k = 0; k < METRICS_HIST_BUCKETS; ++k)
+    {
+      printf(",%lu", (unsigned long)h.buckets[k]);
+    }
+    printf("\n");
+  }
+
+  printf("M,end\n");
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Zera contadores e histogramas (os gauges mantêm o último valor).
+ *  Uma atualização feita ao mesmo tempo pelo outro core pode se perder.
+ *
+ *  @param[in] (void) : Não recebe parâmetros.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void metrics_reset(void)
+{
+  uint32_t irq = save_and_disable_interrupts();
+  for (uint i = 0; i < METRICS_COUNTER_COUNT; ++i)
+  {
+    metrics_counters[i] = 0;
+  }
+  memset(metrics_hists, 0, sizeof(metrics_hists));
+  restore_interrupts(irq);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Esquece o core dono de cada métrica. Chamada quando as fontes de
+ *  métricas passam de um core para o outro, antes que o novo core escreva.
+ *
+ *  @param[in] (void) : Não recebe parâmetros.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void metrics_handoff(void)
+{
+#ifndef NDEBUG
+  memset((void *)metrics_counter_core, 0, sizeof(metrics_counter_core));
+  memset((void *)metrics_hist_core, 0, sizeof(metrics_hist_core));
+#endif
+}
+/* end program */
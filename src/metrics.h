@@ -0,0 +1,172 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Registro de métricas: contadores, gauges e histogramas de
+ *            latência com baldes logarítmicos. Todas as métricas são
+ *            declaradas em tempo de compilação nas listas abaixo, então
+ *            cada atualização é um acesso direto a um índice constante, sem
+ *            busca, alocação ou mutex, e pode ser feita de tarefas ou ISRs.
+ *
+ *            Regra de escrita: cada contador e cada histograma é atualizado
+ *            por um único core por vez. A atomicidade vem de mascarar as
+ *            interrupções do core que escreve, o que não exclui o outro
+ *            core; duas escritas simultâneas em cores diferentes perderiam
+ *            atualizações. Sem NDEBUG a regra é conferida: o primeiro core
+ *            a escrever uma métrica vira seu dono e um assert falha se o
+ *            outro core a escrever depois. Quando as fontes de uma métrica
+ *            mudam de core (o display entregue ao core 1, por exemplo),
+ *            metrics_handoff() esquece os donos. Gauges são escritas simples
+ *            de 32 bits e podem vir de qualquer core.
+ *
+ *  @file	    metrics.h
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+#include <assert.h>
+
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+/* =============================   MACROS   ================================ */
+
+#define METRICS_HIST_BUCKETS 16 // Balde k: valores em [2^(k-1), 2^k); o último acumula o resto
+
+// --- Registro: X(identificador, "nome") ---
+#define METRICS_COUNTERS(X)                 \
+  X(I2C_WRITES,      "i2c.writes")          \
+  X(I2C_BYTES,       "i2c.bytes")           \
+  X(I2C_NACKS,       "i2c.nacks")           \
+  X(I2C_TIMEOUTS,    "i2c.timeouts")        \
+  X(DISPLAY_FRAMES,  "display.frames")      \
+  X(INPUT_EVENTS,    "input.events")        \
+  X(INPUT_PRESSES,   "input.presses")       \
+  X(INPUT_LONG,      "input.long_presses")  \
+  X(RFID_TAGS,       "rfid.tags")
+
+#define METRICS_GAUGES(X)                   \
+  X(INPUT_STATE,     "input.state")         \
+  X(HEAP_FREE,       "heap.free")           \
+  X(RFID_UID_LEN,    "rfid.uid_len")
+
+#define METRICS_HISTOGRAMS(X)               \
+  X(I2C_WRITE_US,    "i2c.write_us")        \
+  X(DISPLAY_RENDER_US, "display.render_us") \
+  X(DISPLAY_FLUSH_US,  "display.flush_us")  \
+  X(INPUT_HANDLE_US, "input.handle_us")     \
+  X(RFID_HANDLE_US,  "rfid.handle_us")
+
+/* =============================   TYPES   ================================= */
+
+#define METRICS_ENUM_C(id, name) METRIC_##id,
+#define METRICS_ENUM_G(id, name) GAUGE_##id,
+#define METRICS_ENUM_H(id, name) HIST_##id,
+enum { METRICS_COUNTERS(METRICS_ENUM_C) METRICS_COUNTER_COUNT };
+enum { METRICS_GAUGES(METRICS_ENUM_G) METRICS_GAUGE_COUNT };
+enum { METRICS_HISTOGRAMS(METRICS_ENUM_H) METRICS_HIST_COUNT };
+
+typedef struct {
+  uint32_t buckets[METRICS_HIST_BUCKETS];
+  uint32_t count; // Amostras
+  uint32_t sum;   // Soma das amostras (para a média)
+  uint32_t max;   // Maior amostra
+} metrics_hist_t;
+
+/* =========================   GLOBAL VARIABLES   ========================== */
+
+extern volatile uint32_t metrics_counters[METRICS_COUNTER_COUNT];
+extern volatile uint32_t metrics_gauges[METRICS_GAUGE_COUNT];
+extern metrics_hist_t metrics_hists[METRICS_HIST_COUNT];
+#ifndef NDEBUG
+extern volatile uint8_t metrics_counter_core[METRICS_COUNTER_COUNT]; // Dono: core + 1 (0: nenhum)
+extern volatile uint8_t metrics_hist_core[METRICS_HIST_COUNT];
+#endif
+
+/* ========================   FUNCTION PROTOTYPE   ========================= */
+
+#ifndef NDEBUG
+/*!
+ *  @brief Confere a regra de escrita: registra o core que escreve a métrica
+ *         na primeira escrita e exige o mesmo core nas seguintes.
+ */
+static inline void metrics_check_core(volatile uint8_t *owner)
+{
+  uint8_t core = (uint8_t)(get_core_num() + 1);
+  if (*owner == 0)
+  {
+    *owner = core;
+  }
+  assert(*owner == core); // Métrica escrita pelos dois cores
+}
+#endif
+
+/*!
+ *  @brief Soma `n` a um contador. O Cortex-M0+ não tem LDREX/STREX, então a
+ *         leitura-modificação-escrita fica atômica mascarando as interrupções
+ *         por três instruções (sem trava e sem espera). Só vale entre tarefas
+ *         e ISRs do mesmo core (ver a regra de escrita no topo).
+ */
+static inline void metrics_add(uint id, uint32_t n)
+{
+#ifndef NDEBUG
+  metrics_check_core(&metrics_counter_core[id]);
+#endif
+  uint32_t irq = save_and_disable_interrupts();
+  metrics_counters[id] += n;
+  restore_interrupts(irq);
+}
+
+static inline void metrics_inc(uint id)
+{
+  metrics_add(id, 1);
+}
+
+/*!
+ *  @brief Atualiza um gauge. Escritas de 32 bits alinhadas já são atômicas.
+ */
+static inline void metrics_set(uint id, uint32_t value)
+{
+  metrics_gauges[id] = value;
+}
+
+/*!
+ *  @brief Registra uma amostra (tipicamente em µs) num histograma. Como em
+ *         metrics_add(), um único core por vez.
+ */
+static inline void metrics_observe(uint id, uint32_t value)
+{
+  uint bucket = value ? 32 - __builtin_clz(value) : 0;
+  metrics_hist_t *h = &metrics_hists[id];
+
+#ifndef NDEBUG
+  metrics_check_core(&metrics_hist_core[id]);
+#endif
+
+  if (bucket >= METRICS_HIST_BUCKETS)
+  {
+    bucket = METRICS_HIST_BUCKETS - 1;
+  }
+
+  uint32_t irq = save_and_disable_interrupts();
+  ++h->buckets[bucket];
+  ++h->count;
+  h->sum += value;
+  if (value > h->max)
+  {
+    h->max = value;
+  }
+  restore_interrupts(irq);
+}
+
+void metrics_dump(void);
+void metrics_reset(void);
+void metrics_handoff(void);
+
+#endif /* METRICS_H */
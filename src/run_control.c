@@ -0,0 +1,247 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Controle de execução/pausa de workers por event group.
+ *
+ *  @file	    run_control.c
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+/* ============================   LIBRARIES  =============================== */
+#include "pico/stdlib.h"
+
+#include "event_groups.h"
+
+#include "run_control.h"
+
+/* =============================   MACROS   ================================ */
+
+// Bits 0..11: execução solicitada; bits 12..23: estado publicado (executando)
+#define RUN_BIT(id)     ((EventBits_t)1 << (id))
+#define RUNNING_BIT(id) ((EventBits_t)1 << ((id) + RUN_CONTROL_MAX_WORKERS))
+#define ALL_WORKERS     (((EventBits_t)1 << RUN_CONTROL_MAX_WORKERS) - 1)
+
+/* =============================   TYPES   ================================= */
+
+typedef struct {
+  run_control_cb_t cb;
+  void *ctx;
+} run_control_subscriber_t;
+
+/* =========================   GLOBAL VARIABLES   ========================== */
+
+static EventGroupHandle_t run_group = NULL;                          // Bits de execução/estado
+static TaskHandle_t worker_tasks[RUN_CONTROL_MAX_WORKERS];           // NULL: worker cooperativo
+static run_control_subscriber_t subscribers[RUN_CONTROL_MAX_SUBSCRIBERS];
+static uint subscriber_count = 0;
+
+/* =======================  DEVELOPMENT OF FUNCTIONS ======================= */
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Cria o event group. Todos os workers começam em execução.
+ *
+ *  @param[in] (void) : Não recebe parâmetros.
+ *
+ *  @return (bool) : false se não houver memória para o event group.
+ *
+ ----------------------------------------------------------------------------*/
+bool run_control_init(void)
+{
+  run_group = xEventGroupCreate();
+  if (run_group == NULL)
+  {
+    return false;
+  }
+  xEventGroupSetBits(run_group, ALL_WORKERS | (ALL_WORKERS << RUN_CONTROL_MAX_WORKERS));
+  return true;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Associa a tarefa que executa o worker `id`.
+ *  Com a tarefa conhecida, um pedido de pausa interrompe run_control_delay().
+ *  Workers executados por um despachante não precisam ser associados.
+ *
+ *  @param[in] id   : Identificador do worker (0..RUN_CONTROL_MAX_WORKERS-1).
+ *  @param[in] task : Tarefa do worker.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void run_control_attach(uint id, TaskHandle_t task)
+{
+  configASSERT(id < RUN_CONTROL_MAX_WORKERS);
+  worker_tasks[id] = task;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Registra um callback chamado a cada transição efetiva de estado.
+ *  Registre os assinantes antes de iniciar o escalonador.
+ *
+ *  @param[in] cb  : Callback (executado no contexto do worker; não pode bloquear).
+ *  @param[in] ctx : Contexto repassado ao callback.
+ *
+ *  @return (bool) : false se a tabela de assinantes estiver cheia.
+ *
+ ----------------------------------------------------------------------------*/
+bool run_control_subscribe(run_control_cb_t cb, void *ctx)
+{
+  if (subscriber_count >= RUN_CONTROL_MAX_SUBSCRIBERS)
+  {
+    return false;
+  }
+  subscribers[subscriber_count].cb = cb;
+  subscribers[subscriber_count].ctx = ctx;
+  ++subscriber_count;
+  return true;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Solicita que o worker execute (`run` = true) ou pause.
+ *  Apenas altera o bit de execução; o worker para no próximo checkpoint.
+ *
+ *  @param[in] id  : Identificador do worker.
+ *  @param[in] run : true para executar, false para pausar.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void run_control_request(uint id, bool run)
+{
+  if (run)
+  {
+    xEventGroupSetBits(run_group, RUN_BIT(id)); // Desbloqueia o worker pausado
+  }
+  else
+  {
+    xEventGroupClearBits(run_group, RUN_BIT(id));
+    if (worker_tasks[id] != NULL)
+    {
+      xTaskNotifyGive(worker_tasks[id]); // Interrompe run_control_delay()
+    }
+  }
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Inverte o pedido de execução do worker.
+ *
+ *  @param[in] id : Identificador do worker.
+ *
+ *  @return (bool) : Novo pedido (true = executar).
+ *
+ ----------------------------------------------------------------------------*/
+bool run_control_toggle(uint id)
+{
+  bool run = !(xEventGroupGetBits(run_group) & RUN_BIT(id));
+  run_control_request(id, run);
+  return run;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Estado publicado pelo worker (não o pedido pendente).
+ *
+ *  @param[in] id : Identificador do worker.
+ *
+ *  @return (bool) : true se o worker está executando.
+ *
+ ----------------------------------------------------------------------------*/
+bool run_control_is_running(uint id)
+{
+  return (xEventGroupGetBits(run_group) & RUNNING_BIT(id)) != 0;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Ponto seguro do worker (não bloqueia).
+ *  Compara o pedido com o estado publicado; havendo diferença, executa `park`
+ *  (ao pausar), publica o novo estado e avisa os assinantes. Sem transição o
+ *  custo é apenas a leitura do event group.
+ *
+ *  @param[in] id   : Identificador do worker.
+ *  @param[in] park : Leva as saídas a um estado seguro ao pausar (pode ser NULL).
+ *  @param[in] arg  : Argumento de `park`.
+ *
+ *  @return (bool) : true se o worker deve continuar executando.
+ *
+ ----------------------------------------------------------------------------*/
+bool run_control_checkpoint(uint id, run_control_park_t park, void *arg)
+{
+  EventBits_t bits = xEventGroupGetBits(run_group);
+  bool run = (bits & RUN_BIT(id)) != 0;
+  bool running = (bits & RUNNING_BIT(id)) != 0;
+
+  if (run == running)
+  {
+    return run;
+  }
+
+  if (run)
+  {
+    xEventGroupSetBits(run_group, RUNNING_BIT(id));
+  }
+  else
+  {
+    if (park != NULL)
+    {
+      park(arg);
+    }
+    xEventGroupClearBits(run_group, RUNNING_BIT(id));
+  }
+
+  for (uint i = 0; i < subscriber_count; ++i)
+  {
+    subscribers[i].cb(id, run, subscribers[i].ctx);
+  }
+  return run;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Ponto seguro bloqueante para workers que são tarefas.
+ *  Enquanto a execução não for solicitada, a tarefa fica bloqueada no bit de
+ *  execução e só acorda quando ele é setado.
+ *
+ *  @param[in] id   : Identificador do worker.
+ *  @param[in] park : Leva as saídas a um estado seguro ao pausar (pode ser NULL).
+ *  @param[in] arg  : Argumento de `park`.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void run_control_wait_run(uint id, run_control_park_t park, void *arg)
+{
+  while (!run_control_checkpoint(id, park, arg))
+  {
+    xEventGroupWaitBits(run_group, RUN_BIT(id), pdFALSE, pdTRUE, portMAX_DELAY);
+  }
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Espera `ticks` ou até um pedido de pausa, o que ocorrer primeiro.
+ *  Usa a notificação da própria tarefa, por isso o worker não pode usar a
+ *  notificação de índice 0 para outros fins.
+ *
+ *  @param[in] id    : Identificador do worker.
+ *  @param[in] ticks : Tempo máximo de espera.
+ *
+ *  @return (bool) : false se a espera foi interrompida por um pedido de pausa.
+ *
+ ----------------------------------------------------------------------------*/
+bool run_control_delay(uint id, TickType_t ticks)
+{
+  TickType_t start = xTaskGetTickCount();
+  TickType_t elapsed = 0;
+
+  while (elapsed < ticks)
+  {
+    ulTaskNotifyTake(pdTRUE, ticks - elapsed);
+    if (!(xEventGroupGetBits(run_group) & RUN_BIT(id)))
+    {
+      return false;
+    }
+    elapsed = xTaskGetTickCount() - start; // Notificação antiga: volta a esperar
+  }
+  return true;
+}
+/* end program */
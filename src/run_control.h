@@ -0,0 +1,61 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Controle de execução/pausa de workers por event group.
+ *            Em vez de vTaskSuspend()/vTaskResume(), quem controla apenas
+ *            limpa ou seta o bit "run" do worker; o worker só para em pontos
+ *            seguros (checkpoints), coloca suas saídas num estado seguro e
+ *            bloqueia no bit. Cada transição efetiva é publicada aos
+ *            assinantes, dispensando polling de estado.
+ *
+ *  @file	    run_control.h
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+#ifndef RUN_CONTROL_H
+#define RUN_CONTROL_H
+
+#include <stdbool.h>
+
+#include "pico/stdlib.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* =============================   MACROS   ================================ */
+
+#define RUN_CONTROL_MAX_WORKERS     12 // Limitado pelos 24 bits úteis do event group
+#define RUN_CONTROL_MAX_SUBSCRIBERS 4  // Callbacks de transição de estado
+
+/* =============================   TYPES   ================================= */
+
+/*!
+ *  @brief Callback de transição: chamado no contexto do worker sempre que
+ *         ele efetivamente pausa (running = false) ou retoma (running = true).
+ */
+typedef void (*run_control_cb_t)(uint id, bool running, void *ctx);
+
+/*!
+ *  @brief Função que leva as saídas do worker a um estado seguro ao pausar.
+ */
+typedef void (*run_control_park_t)(void *arg);
+
+/* ========================   FUNCTION PROTOTYPE   ========================= */
+
+bool run_control_init(void);
+void run_control_attach(uint id, TaskHandle_t task);
+bool run_control_subscribe(run_control_cb_t cb, void *ctx);
+
+void run_control_request(uint id, bool run);
+bool run_control_toggle(uint id);
+bool run_control_is_running(uint id);
+
+bool run_control_checkpoint(uint id, run_control_park_t park, void *arg);
+void run_control_wait_run(uint id, run_control_park_t park, void *arg);
+bool run_control_delay(uint id, TickType_t ticks);
+
+#endif /* RUN_CONTROL_H */
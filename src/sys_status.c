@@ -0,0 +1,92 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Estado do sistema publicado com seqlock.
+ *
+ *  @file	    sys_status.c
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+/* ============================   LIBRARIES  =============================== */
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+#include "sys_status.h"
+
+/* =========================   GLOBAL VARIABLES   ========================== */
+
+static sys_status_t status;            // Estado publicado
+static volatile uint32_t status_seq = 0; // Ímpar enquanto uma escrita está em andamento
+static uint32_t writer_irq;            // Estado das interrupções do escritor atual
+
+/* =======================  DEVELOPMENT OF FUNCTIONS ======================= */
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Abre uma atualização do estado.
+ *  Os escritores são serializados desabilitando as interrupções (funciona
+ *  também antes do escalonador iniciar); a janela deve ser curta, apenas
+ *  atribuições de campos. Leitores nunca desabilitam interrupções.
+ *
+ *  @param[in] (void) : Não recebe parâmetros.
+ *
+ *  @return (sys_status_t *) : Estrutura a ser alterada até sys_status_write_end().
+ *
+ ----------------------------------------------------------------------------*/
+sys_status_t *sys_status_write_begin(void)
+{
+  writer_irq = save_and_disable_interrupts();
+  status_seq = status_seq + 1; // Ímpar: leitores em andamento vão repetir
+  __dmb();
+  return &status;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Fecha a atualização e publica o novo estado.
+ *
+ *  @param[in] (void) : Não recebe parâmetros.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void sys_status_write_end(void)
+{
+  status.updated_ms = to_ms_since_boot(get_absolute_time());
+  __dmb(); // Os campos devem estar visíveis antes da sequência par
+  status_seq = status_seq + 1;
+  restore_interrupts(writer_irq);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Copia um retrato consistente do estado, sem travas.
+ *  Se a sequência for ímpar (escrita em andamento, possível apenas a partir
+ *  do outro core) ou mudar durante a cópia, a cópia é refeita.
+ *
+ *  @param[out] out : Destino do retrato.
+ *
+ *  @return (uint32_t) : Número de sequência do retrato (cresce a cada publicação).
+ *
+ ----------------------------------------------------------------------------*/
+uint32_t sys_status_read(sys_status_t *out)
+{
+  uint32_t seq;
+
+  do
+  {
+    while ((seq = status_seq) & 1u)
+    {
+      tight_loop_contents();
+    }
+    __dmb(); // Lê os campos somente depois da sequência
+    memcpy(out, &status, sizeof(*out));
+    __dmb(); // Termina a cópia antes de reler a sequência
+  } while (seq != status_seq);
+
+  return seq >> 1;
+}
+/* end program */
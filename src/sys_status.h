@@ -0,0 +1,54 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Estado do sistema publicado com seqlock.
+ *            Os produtores atualizam uma única estrutura entre
+ *            sys_status_write_begin() e sys_status_write_end(), que
+ *            incrementam um contador de sequência. Os leitores (display,
+ *            telemetria, console) copiam a estrutura sem travas e sem
+ *            seções críticas, repetindo a cópia se uma escrita ocorreu no
+ *            meio; o resultado é sempre um retrato consistente.
+ *
+ *  @file	    sys_status.h
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+#ifndef SYS_STATUS_H
+#define SYS_STATUS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* =============================   MACROS   ================================ */
+
+#define SYS_STATUS_UID_MAX     10 // UID ISO 14443-A de até 10 bytes
+#define SYS_STATUS_MESSAGE_MAX 22 // 21 caracteres da fonte 5x8 + '\0'
+
+/* =============================   TYPES   ================================= */
+
+// Retrato do sistema; copiado inteiro por cada leitor
+typedef struct {
+  uint32_t updated_ms;        // Instante da última publicação
+  bool led_running;           // Estado publicado do worker do LED
+  bool buzzer_running;        // Estado publicado do worker do buzzer
+  uint32_t rfid_reads;        // Tags lidas desde o boot
+  uint8_t rfid_uid[SYS_STATUS_UID_MAX]; // UID da última tag
+  uint8_t rfid_uid_len;       // Bytes válidos em rfid_uid
+  uint32_t heap_free;         // Heap livre no último relatório
+  uint32_t heap_min;          // Menor heap livre já observado
+  uint32_t ctx_switches_per_s; // Taxa de trocas de contexto
+  uint32_t sys_clock_hz;      // Frequência atual de clk_sys
+  char message[SYS_STATUS_MESSAGE_MAX]; // Linha de mensagem do display
+} sys_status_t;
+
+/* ========================   FUNCTION PROTOTYPE   ========================= */
+
+sys_status_t *sys_status_write_begin(void);
+void sys_status_write_end(void);
+uint32_t sys_status_read(sys_status_t *out);
+
+#endif /* SYS_STATUS_H */
@@ -0,0 +1,205 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Captura do tempo de execução de pior caso (WCET) por job.
+ *
+ *  @file	    wcet.c
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+/* ============================   LIBRARIES  =============================== */
+#include <stdio.h>
+
+#include "pico/stdlib.h"
+
+#include "wcet.h"
+
+/* =============================   TYPES   ================================= */
+
+// Relógio de CPU de uma tarefa (apontado pela task tag)
+typedef struct {
+  volatile uint32_t cpu_us; // Tempo de CPU acumulado até o último switch-out
+  volatile uint32_t in_us;  // Instante do último switch-in
+} wcet_clock_t;
+
+// Estatísticas de um tipo de job
+typedef struct {
+  const char *name;       // Nome do job
+  const char *task_name;  // Tarefa que executa o job
+  UBaseType_t priority;   // Prioridade atual da tarefa
+  uint32_t period_us;     // Período (ou intervalo mínimo entre ativações)
+  uint32_t deadline_us;   // Deadline relativo
+  uint32_t jobs;          // Jobs completos
+  uint32_t max_exec_us;   // Maior tempo de CPU por job (WCET observado)
+  uint64_t sum_exec_us;   // Soma dos tempos de CPU (para a média)
+  uint32_t max_resp_us;   // Maior tempo do início ao fim do job (inclui preempção)
+  uint32_t start_cpu_us;  // Relógio de CPU no início do job atual
+  uint32_t start_us;      // Instante de início do job atual
+} wcet_job_t;
+
+/* =========================   GLOBAL VARIABLES   ========================== */
+
+static wcet_clock_t clocks[WCET_MAX_TASKS];
+static uint clock_count = 0;
+static wcet_job_t jobs[WCET_MAX_JOBS];
+
+/* =======================  DEVELOPMENT OF FUNCTIONS ======================= */
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Hook de switch-in: marca o início da fatia de CPU da tarefa.
+ ----------------------------------------------------------------------------*/
+void wcet_trace_switched_in(void *tag)
+{
+  wcet_clock_t *clk = tag;
+  if (clk != NULL)
+  {
+    clk->in_us = time_us_32();
+  }
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Hook de switch-out: acumula a fatia de CPU da tarefa.
+ ----------------------------------------------------------------------------*/
+void wcet_trace_switched_out(void *tag)
+{
+  wcet_clock_t *clk = tag;
+  if (clk != NULL)
+  {
+    clk->cpu_us += time_us_32() - clk->in_us;
+  }
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Associa um relógio de CPU à tarefa (via application task tag).
+ *  Deve ser chamada antes de a tarefa executar pela primeira vez.
+ *
+ *  @param[in] task : Tarefa que executará jobs medidos.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void wcet_attach_task(TaskHandle_t task)
+{
+  if (task == NULL || clock_count >= WCET_MAX_TASKS)
+  {
+    return;
+  }
+  vTaskSetApplicationTaskTag(task, (TaskHookFunction_t)(void *)&clocks[clock_count++]);
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Descreve um tipo de job para o relatório de escalonabilidade.
+ *
+ *  @param[in] id          : Identificador do job (0..WCET_MAX_JOBS-1).
+ *  @param[in] name        : Nome do job.
+ *  @param[in] task_name   : Tarefa que executa o job (jobs de uma mesma
+ *                           tarefa não podem ter prioridades diferentes).
+ *  @param[in] priority    : Prioridade atual da tarefa.
+ *  @param[in] period_us   : Período ou intervalo mínimo entre ativações.
+ *  @param[in] deadline_us : Deadline relativo.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void wcet_register(uint id, const char *name, const char *task_name, UBaseType_t priority,
+                   uint32_t period_us, uint32_t deadline_us)
+{
+  configASSERT(id < WCET_MAX_JOBS);
+  jobs[id].name = name;
+  jobs[id].task_name = task_name;
+  jobs[id].priority = priority;
+  jobs[id].period_us = period_us;
+  jobs[id].deadline_us = deadline_us;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Lê o relógio de CPU da tarefa corrente, incluindo a fatia atual.
+ ----------------------------------------------------------------------------*/
+static uint32_t wcet_current_cpu_us(void)
+{
+  wcet_clock_t *clk = (wcet_clock_t *)(void *)xTaskGetApplicationTaskTag(NULL);
+  uint32_t cpu;
+
+  if (clk == NULL)
+  {
+    return time_us_32(); // Tarefa sem relógio: mede tempo de parede
+  }
+
+  taskENTER_CRITICAL(); // Evita um switch entre as duas leituras
+  cpu = clk->cpu_us + (time_us_32() - clk->in_us);
+  taskEXIT_CRITICAL();
+  return cpu;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Marca o início de um job (liberação) na tarefa corrente.
+ *
+ *  @param[in] id : Identificador do job.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void wcet_job_begin(uint id)
+{
+  jobs[id].start_us = time_us_32();
+  jobs[id].start_cpu_us = wcet_current_cpu_us();
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Marca o fim de um job e atualiza o pior caso observado.
+ *
+ *  @param[in] id : Identificador do job.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void wcet_job_end(uint id)
+{
+  wcet_job_t *job = &jobs[id];
+  uint32_t exec = wcet_current_cpu_us() - job->start_cpu_us;
+  uint32_t resp = time_us_32() - job->start_us;
+
+  if (exec > job->max_exec_us)
+  {
+    job->max_exec_us = exec;
+  }
+  if (resp > job->max_resp_us)
+  {
+    job->max_resp_us = resp;
+  }
+  job->sum_exec_us += exec;
+  ++job->jobs;
+}
+
+/*! ---------------------------------------------------------------------------
+ *  @brief Imprime uma linha CSV por job registrado, no formato lido por
+ *  tools/rta.py:
+ *  WCET,<job>,<tarefa>,<prio>,<periodo_us>,<deadline_us>,<jobs>,<wcet_us>,<medio_us>,<resp_max_us>
+ *
+ *  @param[in] (void) : Não recebe parâmetros.
+ *
+ *  @return (void) : Não possui valor de retorno.
+ *
+ ----------------------------------------------------------------------------*/
+void wcet_report(void)
+{
+  for (uint i = 0; i < WCET_MAX_JOBS; ++i)
+  {
+    const wcet_job_t *job = &jobs[i];
+    if (job->name == NULL)
+    {
+      continue;
+    }
+    printf("WCET,%s,%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu\n", job->name, job->task_name,
+           (unsigned long)job->priority, (unsigned long)job->period_us,
+           (unsigned long)job->deadline_us, (unsigned long)job->jobs,
+           (unsigned long)job->max_exec_us,
+           (unsigned long)(job->jobs ? job->sum_exec_us / job->jobs : 0),
+           (unsigned long)job->max_resp_us);
+  }
+}
+/* end program */
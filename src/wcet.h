@@ -0,0 +1,59 @@
+/*! ============================================================================
+ *
+ *  Copyright(c) 2025 JV Gomes, EmbarcaTech - All rights reserved.
+ *
+ *  RFID Tag reader
+ *  @brief    Captura do tempo de execução de pior caso (WCET) por job.
+ *            Cada tarefa ganha um relógio de CPU alimentado pelos hooks de
+ *            trace do FreeRTOS, então o tempo medido entre WCET_BEGIN() e
+ *            WCET_END() exclui preempções. O relatório periódico (linhas
+ *            "WCET,...") é a entrada de tools/rta.py, que faz a análise de
+ *            tempo de resposta e sugere as prioridades.
+ *
+ *  @file	    wcet.h
+ *  @author   Joao Vitor G. de Oliveira
+ *  @date	    2 Jun 2025
+ *  @version  1.0
+ *
+============================================================================ */
+#ifndef WCET_H
+#define WCET_H
+
+#include <stdint.h>
+
+#include "pico/stdlib.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* =============================   MACROS   ================================ */
+
+#ifndef APP_WCET
+#define APP_WCET 0 // 1: habilita a captura de WCET (opção CMake APP_WCET)
+#endif
+
+#define WCET_MAX_JOBS  8 // Tipos de job medidos
+#define WCET_MAX_TASKS 8 // Tarefas com relógio de CPU
+
+#if APP_WCET
+#define WCET_BEGIN(id) wcet_job_begin(id)
+#define WCET_END(id)   wcet_job_end(id)
+#else
+#define WCET_BEGIN(id) ((void)0)
+#define WCET_END(id)   ((void)0)
+#endif
+
+/* ========================   FUNCTION PROTOTYPE   ========================= */
+
+void wcet_attach_task(TaskHandle_t task);
+void wcet_register(uint id, const char *name, const char *task_name, UBaseType_t priority,
+                   uint32_t period_us, uint32_t deadline_us);
+void wcet_job_begin(uint id);
+void wcet_job_end(uint id);
+void wcet_report(void);
+
+// Chamadas pelos hooks traceTASK_SWITCHED_IN/OUT (FreeRTOSConfig.h)
+void wcet_trace_switched_in(void *tag);
+void wcet_trace_switched_out(void *tag);
+
+#endif /* WCET_H */
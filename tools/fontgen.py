@@ -0,0 +1,370 @@
+#!/usr/bin/env python3
+"""Gera as fontes derivadas do driver SSD1306 a partir da fonte 5x8.
+
+Lê o vetor font_8x5 de lib/ssd1306/include/font.h e escreve:
+
+    lib/ssd1306/include/font_ext.h
+        ssd1306_charmap_latin1  tabela de dois níveis código -> glifo
+        font_8x5_ext            glifos 5x8 do Latin-1 e de alguns símbolos
+
+    lib/ssd1306/include/font_prop.h (formato ssd1306_font_t)
+        ssd1306_font_prop8   8 px de altura, colunas vazias removidas
+        ssd1306_font_prop16  16 px de altura, ampliada com Scale2x (EPX)
+
+As letras acentuadas são compostas: a letra base (maiúsculas comprimidas para
+5 linhas, removendo linhas repetidas) recebe o acento nas duas linhas de cima.
+Os demais caracteres estendidos são desenhados à mão em EXTRA_GLYPHS.
+
+O Scale2x suaviza diagonais e curvas em vez de apenas duplicar pixels, então
+a fonte de 16 px é um bitmap nativo gerado uma única vez, fora do firmware.
+Cada glifo guarda a largura real e o avanço horizontal (largura + espaço).
+
+Tabela de caracteres: o primeiro nível (`rows`) tem um byte por bloco de 32
+códigos até `limit` e diz qual bloco do segundo nível o descreve (0 = nenhum);
+cada bloco do segundo nível (`blocks`) tem 32 bytes com o número do glifo
+estendido + 1 (0 = sem glifo). A busca são dois acessos a vetor, O(1).
+
+Uso:
+    python3 tools/fontgen.py
+"""
+
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+SRC = os.path.join(ROOT, "lib", "ssd1306", "include", "font.h")
+DST = os.path.join(ROOT, "lib", "ssd1306", "include", "font_prop.h")
+DST_EXT = os.path.join(ROOT, "lib", "ssd1306", "include", "font_ext.h")
+
+BLOCK = 32  # Códigos por bloco do segundo nível
+
+# Acentos nas linhas 0 e 1 (cedilha na linha 7)
+ACCENTS = {
+    "grave":     [".#...", "..#.."],
+    "acute":     ["...#.", "..#.."],
+    "circ":      ["..#..", ".#.#."],
+    "tilde":     [".##.#", "#..#."],
+    "diaeresis": [".#.#.", "....."],
+    "ring":      [".###.", ".#.#."],
+}
+
+# Código -> (letra base, acento)
+COMPOSED = {}
+for base, codes in (("A", "ÀÁÂÃÄÅ"), ("E", "ÈÉÊË"), ("I", "ÌÍÎÏ"),
+                    ("O", "ÒÓÔÕÖ"), ("U", "ÙÚÛÜ"), ("a", "àáâãäå"),
+                    ("e", "èéêë"), ("i", "ìíîï"), ("o", "òóôõö"),
+                    ("u", "ùúûü")):
+    marks = ["grave", "acute", "circ", "tilde", "diaeresis", "ring"]
+    if base in "EIeiUu":
+        marks = ["grave", "acute", "circ", "diaeresis"]
+    for ch, mark in zip(codes, marks):
+        COMPOSED[ord(ch)] = (base, mark)
+COMPOSED.update({ord("Ñ"): ("N", "tilde"), ord("ñ"): ("n", "tilde"),
+                 ord("Ý"): ("Y", "acute"), ord("ý"): ("y", "acute"),
+                 ord("ÿ"): ("y", "diaeresis"),
+                 ord("Ç"): ("C", "cedilla"), ord("ç"): ("c", "cedilla")})
+
+# Glifos desenhados à mão: 8 linhas de 5 colunas
+EXTRA_GLYPHS = {
+    0x00A0: ["....."] * 8,
+    0x00A1: ["..#..", ".....", "..#..", "..#..", "..#..", "..#..", "..#..", "....."],
+    0x00A2: ["..#..", ".###.", "#.#..", "#.#..", "#.#..", ".###.", "..#..", "....."],
+    0x00A3: ["..##.", ".#..#", ".#...", "###..", ".#...", ".#..#", "####.", "....."],
+    0x00A4: [".....", "#...#", ".###.", ".#.#.", ".###.", "#...#", ".....", "....."],
+    0x00A5: ["#...#", ".#.#.", "..#..", "#####", "..#..", "#####", "..#..", "....."],
+    0x00A6: ["..#..", "..#..", "..#..", ".....", "..#..", "..#..", "..#..", "....."],
+    0x00A7: [".###.", "#....", ".###.", "#...#", ".###.", "....#", ".###.", "....."],
+    0x00A8: [".#.#.", ".....", ".....", ".....", ".....", ".....", ".....", "....."],
+    0x00A9: [".###.", "#...#", "#.###", "##..#", "#.###", "#...#", ".###.", "....."],
+    0x00AA: ["###..", "..#..", "###..", "#.#..", "###..", ".....", "###..", "....."],
+    0x00AB: [".....", "..#.#", ".#.#.", "#.#..", ".#.#.", "..#.#", ".....", "....."],
+    0x00AC: [".....", ".....", "#####", "....#", "....#", ".....", ".....", "....."],
+    0x00AD: [".....", ".....", ".....", "#####", ".....", ".....", ".....", "....."],
+    0x00AE: [".###.", "#...#", "###.#", "###.#", "##.##", "#...#", ".###.", "....."],
+    0x00AF: ["#####", ".....", ".....", ".....", ".....", ".....", ".....", "....."],
+    0x00B0: [".##..", "#..#.", "#..#.", ".##..", ".....", ".....", ".....", "....."],
+    0x00B1: ["..#..", "..#..", "#####", "..#..", "..#..", ".....", "#####", "....."],
+    0x00B2: ["##...", "..#..", ".#...", "###..", ".....", ".....", ".....", "....."],
+    0x00B3: ["##...", "..#..", ".#...", "..#..", "##...", ".....", ".....", "....."],
+    0x00B4: ["...#.", "..#..", ".....", ".....", ".....", ".....", ".....", "....."],
+    0x00B5: [".....", ".....", "#..#.", "#..#.", "#..#.", "###.#", "#....", "#...."],
+    0x00B6: [".####", "###.#", "###.#", ".##.#", "..#.#", "..#.#", "..#.#", "....."],
+    0x00B7: [".....", ".....", ".....", "..#..", ".....", ".....", ".....", "....."],
+    0x00B8: [".....", ".....", ".....", ".....", ".....", ".....", "..#..", ".##.."],
+    0x00B9: [".#...", "##...", ".#...", ".#...", "###..", ".....", ".....", "....."],
+    0x00BA: ["###..", "#.#..", "#.#..", "###..", ".....", "###..", ".....", "....."],
+    0x00BB: [".....", "#.#..", ".#.#.", "..#.#", ".#.#.", "#.#..", ".....", "....."],
+    0x00BC: ["#....", "#..#.", "#.#..", "..#..", ".#.#.", "#.##.", "..###", "...#."],
+    0x00BD: ["#....", "#..#.", "#.#..", "..#..", ".#.##", "#...#", "...#.", "..###"],
+    0x00BE: ["##...", ".#.#.", "##...", "..#..", ".#.#.", "#.##.", "..###", "...#."],
+    0x00BF: ["..#..", ".....", "..#..", ".#...", "#....", "#...#", ".###.", "....."],
+    0x00C6: [".####", "#.#..", "#.#..", "####.", "#.#..", "#.#..", "#.###", "....."],
+    0x00D0: ["####.", "#...#", "#...#", "###.#", "#...#", "#...#", "####.", "....."],
+    0x00D7: [".....", "#...#", ".#.#.", "..#..", ".#.#.", "#...#", ".....", "....."],
+    0x00D8: [".###.", "#..##", "#.#.#", "#.#.#", "#.#.#", "##..#", ".###.", "....."],
+    0x00DE: ["#....", "####.", "#...#", "#...#", "####.", "#....", "#....", "....."],
+    0x00DF: [".##..", "#..#.", "#..#.", "#.#..", "#..#.", "#..#.", "#.#..", "....."],
+    0x00E6: [".....", ".....", "##.#.", "..#.#", ".####", "#.#..", ".####", "....."],
+    0x00F0: ["#.#..", ".#...", "#.#..", ".###.", "#...#", "#...#", ".###.", "....."],
+    0x00F7: [".....", "..#..", ".....", "#####", ".....", "..#..", ".....", "....."],
+    0x00F8: [".....", ".....", ".####", "#..##", "#.#.#", "##..#", "####.", "....."],
+    0x00FE: ["#....", "#....", "####.", "#...#", "####.", "#....", "#....", "....."],
+    0x2013: [".....", ".....", ".....", "####.", ".....", ".....", ".....", "....."],
+    0x2014: [".....", ".....", ".....", "#####", ".....", ".....", ".....", "....."],
+    0x2018: ["..#..", ".#...", ".#...", ".....", ".....", ".....", ".....", "....."],
+    0x2019: ["..#..", "..#..", ".#...", ".....", ".....", ".....", ".....", "....."],
+    0x201C: [".#.#.", "#.#..", "#.#..", ".....", ".....", ".....", ".....", "....."],
+    0x201D: [".#.#.", ".#.#.", "#.#..", ".....", ".....", ".....", ".....", "....."],
+    0x2022: [".....", ".....", ".###.", ".###.", ".###.", ".....", ".....", "....."],
+    0x2026: [".....", ".....", ".....", ".....", ".....", ".....", "#.#.#", "....."],
+    0x20AC: ["..###", ".#...", "####.", ".#...", "####.", ".#...", "..###", "....."],
+    0x2190: [".....", "..#..", ".#...", "#####", ".#...", "..#..", ".....", "....."],
+    0x2191: ["..#..", ".###.", "#.#.#", "..#..", "..#..", "..#..", "..#..", "....."],
+    0x2192: [".....", "..#..", "...#.", "#####", "...#.", "..#..", ".....", "....."],
+    0x2193: ["..#..", "..#..", "..#..", "..#..", "#.#.#", ".###.", "..#..", "....."],
+    0x2713: [".....", "....#", "...#.", "#..#.", ".##..", "..#..", ".....", "....."],
+    0x2717: [".....", "#...#", ".#.#.", "..#..", ".#.#.", "#...#", ".....", "....."],
+}
+
+
+def load_font_8x5(path):
+    """Retorna {código: [5 bytes de coluna]} da fonte original."""
+    text = open(path, encoding="utf-8").read()
+    body = text[text.index("font_8x5"):]
+    body = body[body.index("{") + 1:body.index("}")]
+    values = [int(v, 0) for v in re.findall(r"0x[0-9A-Fa-f]+|\d+", body)]
+    height, width, _, first, last = values[:5]
+    data = values[5:]
+    assert height == 8
+    return {c: data[(c - first) * width:(c - first + 1) * width]
+            for c in range(first, last + 1)}
+
+
+def to_pixels(columns, height):
+    """Colunas (bit 0 no topo) -> matriz [linha][coluna] de 0/1."""
+    return [[(col >> y) & 1 for col in columns] for y in range(height)]
+
+
+def to_columns(pixels):
+    """Matriz [linha][coluna] -> colunas com bit 0 no topo."""
+    height = len(pixels)
+    width = len(pixels[0]) if pixels else 0
+    return [sum(pixels[y][x] << y for y in range(height)) for x in range(width)]
+
+
+def scale2x(pixels):
+    """Ampliação EPX/Scale2x de uma matriz binária."""
+    h, w = len(pixels), len(pixels[0])
+
+    def px(y, x):
+        return pixels[y][x] if 0 <= y < h and 0 <= x < w else 0
+
+    out = [[0] * (2 * w) for _ in range(2 * h)]
+    for y in range(h):
+        for x in range(w):
+            p = px(y, x)
+            a, b, c, d = px(y - 1, x), px(y, x + 1), px(y, x - 1), px(y + 1, x)
+            out[2 * y][2 * x] = a if (c == a and c != d and a != b) else p
+            out[2 * y][2 * x + 1] = b if (a == b and a != c and b != d) else p
+            out[2 * y + 1][2 * x] = c if (d == c and d != b and c != a) else p
+            out[2 * y + 1][2 * x + 1] = d if (b == d and b != a and d != c) else p
+    return out
+
+
+def rows_to_columns(rows):
+    """Desenho em texto ('#' aceso) -> colunas com bit 0 no topo."""
+    return to_columns([[1 if ch == "#" else 0 for ch in row] for row in rows])
+
+
+def squeeze_rows(rows, count):
+    """Reduz uma letra de 7 linhas a `count` linhas, removendo primeiro as
+    linhas repetidas das sequências mais longas."""
+    rows = list(rows)
+    while len(rows) > count:
+        best, best_run, run = None, 1, 1
+        for y in range(1, len(rows)):
+            run = run + 1 if rows[y] == rows[y - 1] else 1
+            if run > best_run:
+                best, best_run = y, run
+        rows.pop(best if best is not None else 1)
+    return rows
+
+
+def compose(base, letter, mark):
+    """Letra base + acento, no grid 5x8."""
+    cols = base[ord(letter)]
+    rows = [["#" if (col >> y) & 1 else "." for col in cols] for y in range(8)]
+    rows = ["".join(r) for r in rows]
+    if letter.isupper():
+        rows = ["....."] * 2 + squeeze_rows(rows[:7], 5) + [rows[7]]
+    else:
+        rows = ["....."] * 2 + rows[2:]
+    if mark == "cedilla":
+        rows[7] = "..##."
+    else:
+        rows[0:2] = ACCENTS[mark]
+    return rows_to_columns(rows)
+
+
+def extended_glyphs(base):
+    """{código: 5 colunas} dos caracteres fora do ASCII."""
+    ext = {code: rows_to_columns(rows) for code, rows in EXTRA_GLYPHS.items()}
+    for code, (letter, mark) in COMPOSED.items():
+        ext[code] = compose(base, letter, mark)
+    assert set(range(0xA0, 0x100)) <= set(ext), "Latin-1 incompleto"
+    return ext
+
+
+def build_charmap(codes):
+    """Tabela de dois níveis: (limit, rows, blocks)."""
+    limit = (max(codes) // BLOCK + 1) * BLOCK
+    rows = [0] * (limit // BLOCK)
+    blocks = []
+    for index, code in enumerate(codes):
+        row = code // BLOCK
+        if rows[row] == 0:
+            blocks.append([0] * BLOCK)
+            rows[row] = len(blocks)
+        blocks[rows[row] - 1][code % BLOCK] = index + 1
+    assert len(codes) < 256 and len(blocks) < 256
+    return limit, rows, blocks
+
+
+def trim(columns):
+    """Remove colunas vazias à esquerda e à direita."""
+    start, end = 0, len(columns)
+    while start < end and columns[start] == 0:
+        start += 1
+    while end > start and columns[end - 1] == 0:
+        end -= 1
+    return columns[start:end]
+
+
+def build(glyphs, height, spacing, space_advance):
+    """Monta (tabela de glifos, bitmap) no formato ssd1306_font_t."""
+    pages = (height + 7) // 8
+    table, bitmap = [], []
+    for code in sorted(glyphs):
+        cols = trim(glyphs[code])
+        advance = len(cols) + spacing if cols else space_advance
+        table.append((len(bitmap) // pages, len(cols), advance, code))
+        for col in cols:
+            bitmap.extend((col >> (8 * p)) & 0xFF for p in range(pages))
+    return table, bitmap
+
+
+def label(code):
+    if code >= 0x80:
+        return "U+%04X" % code
+    ch = chr(code)
+    return {"\\": "backslash", "'": "quote"}.get(ch, ch)
+
+
+def emit(out, name, height, table, bitmap, last):
+    """Escreve uma fonte ssd1306_font_t; `last` é o último glifo ASCII."""
+    pages = (height + 7) // 8
+    first = table[0][3]
+    out.append("static const ssd1306_glyph_t %s_glyphs[] SSD1306_FONT_ATTR =\n{\n" % name)
+    for offset, width, advance, code in table:
+        out.append("\t\t\t{%5d, %2d, %2d}, /* %s */\n" % (offset, width, advance, label(code)))
+    out.append("};\n\n")
+    out.append("static const uint8_t %s_bitmap[] SSD1306_FONT_ATTR =\n{\n" % name)
+    for i in range(0, len(bitmap), 12):
+        out.append("\t\t\t" + ", ".join("0x%02X" % b for b in bitmap[i:i + 12]) + ",\n")
+    out.append("};\n\n")
+    out.append("const ssd1306_font_t %s =\n{\n" % name)
+    out.append("\t\t\t%d, %d, %d, %d, %s_glyphs, %s_bitmap, &ssd1306_charmap_latin1\n};\n\n" % (
+        height, pages, first, last, name, name))
+
+
+def emit_ext(out, codes, ext, limit, rows, blocks):
+    out.append("static const uint8_t ssd1306_charmap_latin1_rows[] SSD1306_FONT_ATTR =\n{\n")
+    for i in range(0, len(rows), 16):
+        out.append("\t\t\t" + ", ".join("%d" % r for r in rows[i:i + 16]) + ",\n")
+    out.append("};\n\n")
+    out.append("static const uint8_t ssd1306_charmap_latin1_blocks[] SSD1306_FONT_ATTR =\n{\n")
+    for block in blocks:
+        for i in range(0, BLOCK, 16):
+            out.append("\t\t\t" + ", ".join("%3d" % g for g in block[i:i + 16]) + ",\n")
+    out.append("};\n\n")
+    out.append("const ssd1306_charmap_t ssd1306_charmap_latin1 =\n{\n")
+    out.append("\t\t\t0x%04X, %d, ssd1306_charmap_latin1_rows, ssd1306_charmap_latin1_blocks\n};\n\n"
+               % (limit, len(codes)))
+    out.append("static const uint8_t font_8x5_ext[] SSD1306_FONT_ATTR =\n{\n")
+    for code in codes:
+        out.append("\t\t\t" + ", ".join("0x%02X" % c for c in ext[code]) + ", /* %s */\n" % label(code))
+    out.append("};\n\n")
+
+
+def main():
+    base = load_font_8x5(SRC)
+
+    ext = extended_glyphs(base)
+    codes = sorted(ext)
+    limit, rows, blocks = build_charmap(codes)
+
+    out = ["""/*
+ * Extended characters of font_8x5, generated by tools/fontgen.py.
+ * Do not edit by hand: change the generator and run it again.
+ *
+ * ssd1306_charmap_latin1 maps a code point to an extended glyph number in
+ * two array lookups: rows[cp/32] selects a 32 entry block (0: none) and the
+ * block holds glyph number + 1 (0: no glyph). font_8x5_ext holds the glyphs
+ * in the same order, in the column format of font_8x5.
+ */
+
+#ifndef _inc_font_ext
+#define _inc_font_ext
+
+#ifndef SSD1306_FONT_ATTR
+#define SSD1306_FONT_ATTR
+#endif
+
+"""]
+    emit_ext(out, codes, ext, limit, rows, blocks)
+    out.append("#endif\n")
+    write(DST_EXT, out)
+
+    glyphs = dict(base)
+    glyphs.update(ext)
+    prop8 = {c: list(cols) for c, cols in glyphs.items()}
+    prop16 = {c: to_columns(scale2x(to_pixels(cols, 8))) for c, cols in glyphs.items()}
+    last = max(base)
+
+    out = ["""/*
+ * Proportional fonts generated by tools/fontgen.py from font_8x5.
+ * Do not edit by hand: change the generator and run it again.
+ *
+ * Format (see ssd1306_font_t): one glyph entry per character with the
+ * offset of its first column in the bitmap, its width in columns and its
+ * horizontal advance. Columns are stored top to bottom, <pages> bytes per
+ * column, bit 0 on top. Glyphs first..last are ASCII; the extended glyphs of
+ * ssd1306_charmap_latin1 follow them in charmap order.
+ */
+
+#ifndef _inc_font_prop
+#define _inc_font_prop
+
+#ifndef SSD1306_FONT_ATTR
+#define SSD1306_FONT_ATTR
+#endif
+
+"""]
+    table, bitmap = build(prop8, 8, 1, 3)
+    emit(out, "ssd1306_font_prop8", 8, table, bitmap, last)
+    table, bitmap = build(prop16, 16, 2, 6)
+    emit(out, "ssd1306_font_prop16", 16, table, bitmap, last)
+    out.append("#endif\n")
+    write(DST, out)
+    return 0
+
+
+def write(path, out):
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("".join(out))
+    print("escrito %s" % os.path.relpath(path, ROOT))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""Análise de tempo de resposta (RTA) a partir das linhas WCET do firmware.
+
+Compile com -DAPP_WCET=ON, deixe o sistema rodando pelo tempo desejado e
+capture a saída serial. Cada relatório traz uma linha por job:
+
+    WCET,<job>,<tarefa>,<prio>,<periodo_us>,<deadline_us>,<jobs>,<wcet_us>,<medio_us>,<resp_max_us>
+
+A ferramenta usa a última linha de cada job, aplica a análise clássica de
+escalonamento por prioridade fixa preemptiva
+
+    R = C + sum(ceil(R / Tj) * Cj)   para todo j com prioridade >= a de i
+
+(prioridades iguais contam como interferência, o que cobre o time slicing do
+FreeRTOS e os handlers de um mesmo despachante), e compara as prioridades
+atuais com uma atribuição deadline-monotonic (rate-monotonic quando D = T).
+Jobs executados pela mesma tarefa recebem sempre a mesma prioridade.
+
+Uso:
+    python3 tools/rta.py captura.log [--margin 1.2] [--risk 0.8]
+"""
+
+import argparse
+import math
+import sys
+
+
+class Job:
+    def __init__(self, fields):
+        self.name = fields[0]
+        self.task = fields[1]
+        self.prio = int(fields[2])
+        self.period = int(fields[3])
+        self.deadline = int(fields[4])
+        self.count = int(fields[5])
+        self.wcet = int(fields[6])
+        self.avg = int(fields[7])
+        self.resp = int(fields[8])
+
+
+def parse(lines):
+    """Retorna o último registro de cada job encontrado na captura."""
+    jobs = {}
+    for line in lines:
+        line = line.strip()
+        idx = line.find("WCET,")
+        if idx < 0:
+            continue
+        fields = line[idx + 5:].split(",")
+        if len(fields) != 9:
+            continue
+        try:
+            job = Job(fields)
+        except ValueError:
+            continue
+        jobs[job.name] = job
+    return list(jobs.values())
+
+
+def response_time(job, jobs, prio_of, cost_of):
+    """Menor ponto fixo de R; None se passar do deadline (não escalonável)."""
+    hp = [j for j in jobs if j is not job and prio_of[j.name] >= prio_of[job.name]]
+    c = cost_of[job.name]
+    r = c + sum(cost_of[j.name] for j in hp)
+    while True:
+        if r > job.deadline:
+            return None
+        nxt = c + sum(math.ceil(r / j.period) * cost_of[j.name] for j in hp)
+        if nxt == r:
+            return r
+        r = nxt
+
+
+def deadline_monotonic(jobs, base_prio):
+    """Prioridades por deadline crescente, uma por tarefa (maior = mais urgente)."""
+    task_deadline = {}
+    for j in jobs:
+        task_deadline[j.task] = min(task_deadline.get(j.task, j.deadline), j.deadline)
+    order = sorted(task_deadline, key=lambda t: task_deadline[t], reverse=True)
+    task_prio = {t: base_prio + i for i, t in enumerate(order)}
+    return {j.name: task_prio[j.task] for j in jobs}
+
+
+def status(r, deadline, risk):
+    if r is None:
+        return "PERDE"
+    if r > risk * deadline:
+        return "RISCO"
+    return "ok"
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("log", nargs="?", help="captura da serial (padrão: stdin)")
+    ap.add_argument("--margin", type=float, default=1.0,
+                    help="fator aplicado ao WCET observado (ex.: 1.2 = +20%%)")
+    ap.add_argument("--risk", type=float, default=0.8,
+                    help="fração do deadline a partir da qual o job é marcado como RISCO")
+    args = ap.parse_args()
+
+    src = open(args.log, encoding="utf-8", errors="replace") if args.log else sys.stdin
+    jobs = parse(src)
+    if not jobs:
+        print("nenhuma linha WCET encontrada (compile com -DAPP_WCET=ON)")
+        return 2
+
+    cost = {j.name: math.ceil(j.wcet * args.margin) for j in jobs}
+    current = {j.name: j.prio for j in jobs}
+    suggested = deadline_monotonic(jobs, min(current.values()))
+    util = sum(cost[j.name] / j.period for j in jobs)
+    n = len(jobs)
+
+    print("%-10s %-14s %8s %8s %8s %6s | %4s %8s %-5s | %4s %8s %-5s" % (
+        "job", "tarefa", "C(us)", "T(us)", "D(us)", "jobs",
+        "prio", "R(us)", "atual", "prio", "R(us)", "DM"))
+    failures = 0
+    for j in sorted(jobs, key=lambda j: j.deadline):
+        r_cur = response_time(j, jobs, current, cost)
+        r_dm = response_time(j, jobs, suggested, cost)
+        st_cur = status(r_cur, j.deadline, args.risk)
+        st_dm = status(r_dm, j.deadline, args.risk)
+        failures += st_cur != "ok"
+        print("%-10s %-14s %8d %8d %8d %6d | %4d %8s %-5s | %4d %8s %-5s" % (
+            j.name, j.task, cost[j.name], j.period, j.deadline, j.count,
+            current[j.name], "-" if r_cur is None else r_cur, st_cur,
+            suggested[j.name], "-" if r_dm is None else r_dm, st_dm))
+
+    print()
+    print("utilização U = %.3f (limite de Liu & Layland para %d jobs: %.3f)" % (
+        util, n, n * (2 ** (1.0 / n) - 1)))
+    if util > 1.0:
+        print("U > 1: nenhuma atribuição de prioridades torna o conjunto escalonável")
+
+    changes = sorted({(j.task, current[j.name], suggested[j.name])
+                      for j in jobs if current[j.name] != suggested[j.name]})
+    if changes:
+        print("prioridades sugeridas (deadline-monotonic):")
+        for task, cur, sug in changes:
+            print("  %-14s %2d -> %2d" % (task, cur, sug))
+    else:
+        print("as prioridades atuais já seguem a ordem deadline-monotonic")
+
+    unseen = [j.name for j in jobs if j.count == 0]
+    if unseen:
+        print("atenção: jobs sem nenhuma execução medida: %s" % ", ".join(unseen))
+
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())